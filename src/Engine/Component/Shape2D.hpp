@@ -1,6 +1,10 @@
 #pragma once
 #include <Math/Math.hpp>
 #include <Engine/Component/Component.hpp>
+#include <Engine/Memory/ObjectPool.hpp>
+#include <map>
+#include <mutex>
+#include <atomic>
 
 // TODO: update as Object2D
 
@@ -13,7 +17,7 @@ public:
     glm::vec2 center;
     virtual void computeVertices() {};
     virtual void computeEdges() {};
-    virtual AABB getAABB() {return {};};
+    virtual AABB getAABB() const {return {};};
     void computeCenter()
     {
         if (vertices.size()) computeVertices();
@@ -56,10 +60,18 @@ public:
 
     Shape2D() = default;
     virtual ~Shape2D() = default;
+
+    // Shapes are immutable once built and shared by any number of colliders, across worlds.
+    // Each collider holds a reference, the last one to let go deletes the shape.
+    void Retain() const { references.fetch_add(1, std::memory_order_relaxed); }
+    void Release() const { if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this; }
+
+private:
+    mutable std::atomic<uint32_t> references = 0;
 };
 
 // Box2D
-class Box2D : public Shape2D
+class Box2D final : public Shape2D, public Pooled<Box2D>
 {
 public:
     // Constructors
@@ -112,13 +124,13 @@ public:
             edges.push_back({vertices[i], vertices[(i + 1) % 4]});
     }
 
-    AABB getAABB() override {
+    AABB getAABB() const override {
         return AABB({0.0f, 0.0f}, {w, h});
     }
 };
 
 // Circle2D
-class Circle2D : public Shape2D
+class Circle2D final : public Shape2D, public Pooled<Circle2D>
 {
 public:
     // Constructor
@@ -151,7 +163,7 @@ public:
         }
     }
 
-    AABB getAABB() override {
+    AABB getAABB() const override {
         return AABB({0.0f, 0.0f}, radius);
     }
 
@@ -164,3 +176,41 @@ public:
             edges.push_back({vertices[i], vertices[(i + 1) % size]});
     }
 };
+
+// Registry of shared shapes, one instance per distinct size.
+// Size lives in the shape, per-instance scale in the collider's Transform2D.
+class ShapeLibrary {
+public:
+    static const Box2D* Box(float width, float height) {
+        return Find(Boxes, {width, height}, [&] { return new Box2D(width, height); });
+    }
+
+    static const Circle2D* Circle(float radius, int points = 3) {
+        return Find(Circles, {radius, float(points)}, [&] { return new Circle2D(radius, points); });
+    }
+
+    // Drops the library's references, shapes still in use live on with their colliders
+    static void Clear() {
+        std::lock_guard<std::mutex> lock(Mutex);
+        for (auto& [size, box] : Boxes) box->Release();
+        for (auto& [size, circle] : Circles) circle->Release();
+        Boxes.clear();
+        Circles.clear();
+    }
+
+private:
+    template <typename T, typename Make>
+    static const T* Find(std::map<std::pair<float, float>, T*>& shapes, std::pair<float, float> size, Make make) {
+        std::lock_guard<std::mutex> lock(Mutex);
+        auto it = shapes.find(size);
+        if (it != shapes.end()) return it->second;
+        T* shape = make();
+        shape->Retain();
+        shapes.emplace(size, shape);
+        return shape;
+    }
+
+    inline static std::map<std::pair<float, float>, Box2D*> Boxes;
+    inline static std::map<std::pair<float, float>, Circle2D*> Circles;
+    inline static std::mutex Mutex;     // shared by every world's setup
+};
@@ -1,62 +1,114 @@
 #pragma once
 #include <Math/Math.hpp>
+#include <Math/SIMD.hpp>
 #include <Engine/Component/Component.hpp>
+#include <Engine/Memory/ObjectPool.hpp>
+#include <span>
 
-class Transform2D : Component {
+static_assert(sizeof(glm::vec2) == 2 * sizeof(float), "Transform2D batches read vec2 arrays as interleaved floats");
+
+class TransformHierarchy;
+
+class Transform2D final : Component, public Pooled<Transform2D> {
 public:
     glm::vec2 offset;
     glm::vec2 position;
     glm::vec2 scale;
-    float rotation;
-
-    std::vector<glm::vec2> Apply(std::vector<glm::vec2> points) const {
-        std::vector<glm::vec2> result;
-        float rad = deg2rad(rotation);
-        float cosR = std::cos(rad);
-        float sinR = std::sin(rad);
-        for (glm::vec2 point : points) {
-            point *= scale;
-            glm::vec2 rotated{
-                point.x * cosR - point.y * sinR,
-                point.x * sinR + point.y * cosR
-            };
-            point = rotated + position + offset;
-            result.push_back(point);
+    glm::vec2 orientation;  // unit (cos, sin), degrees only through get/setRotation
+
+    float getRotation() const { return orientation_to_degrees(orientation); }
+    void setRotation(float degrees) { orientation = orientation_from_degrees(degrees); }
+
+    // Parenting (see TransformHierarchy): a child's position / orientation / scale are written by its
+    // hierarchy from the parent's and this local pose, edit the local pose through the setters
+    Transform2D* getParent() const { return parent; }
+    glm::vec2 getLocalPosition() const { return localPosition; }
+    float getLocalRotation() const { return orientation_to_degrees(localOrientation); }
+    glm::vec2 getLocalScale() const { return localScale; }
+    void setLocalPosition(glm::vec2 position) { localPosition = position; localDirty = true; }
+    void setLocalRotation(float degrees) { localOrientation = orientation_from_degrees(degrees); localDirty = true; }
+    void setLocalScale(glm::vec2 scale) { localScale = scale; localDirty = true; }
+
+    // Span variants: no allocation, `out` holds points.size() entries and may alias `points`.
+    // Two interleaved points per SIMD lane group, same operations in the same order as the scalar tail.
+    void Apply(std::span<const glm::vec2> points, std::span<glm::vec2> out) const {
+        const float cosR = orientation.x;
+        const float sinR = orientation.y;
+
+        const float* in = reinterpret_cast<const float*>(points.data());
+        float* result = reinterpret_cast<float*>(out.data());
+        const SIMD::float4 s = SIMD::Set(scale.x, scale.y, scale.x, scale.y);
+        const SIMD::float4 c = SIMD::Set(cosR);
+        const SIMD::float4 n = SIMD::Set(-sinR, sinR, -sinR, sinR);
+        const SIMD::float4 p = SIMD::Set(position.x, position.y, position.x, position.y);
+        const SIMD::float4 o = SIMD::Set(offset.x, offset.y, offset.x, offset.y);
+
+        size_t i = 0;
+        for (; i + 2 <= points.size(); i += 2) {
+            SIMD::float4 q = SIMD::Load(in + 2 * i) * s;
+            SIMD::Store(result + 2 * i, (q * c + SIMD::SwapPairs(q) * n) + p + o);
         }
-        return result;
+        for (; i < points.size(); i++) {
+            glm::vec2 point = points[i] * scale;
+            out[i] = glm::vec2(point.x * cosR - point.y * sinR, point.x * sinR + point.y * cosR) + position + offset;
+        }
+    }
+
+    void ApplyScale(std::span<const glm::vec2> points, std::span<glm::vec2> out) const {
+        for (size_t i = 0; i < points.size(); i++) out[i] = points[i] * scale;
     }
 
-    std::vector<glm::vec2> ApplyScale(std::vector<glm::vec2> points) const {
-        std::vector<glm::vec2> result;
-        for (glm::vec2 point : points) {
-            point *= scale;
-            result.push_back(point);
+    void ApplyPosition(std::span<const glm::vec2> points, std::span<glm::vec2> out) const {
+        const glm::vec2 translation = position + offset;
+        for (size_t i = 0; i < points.size(); i++) out[i] = points[i] + translation;
+    }
+
+    void ApplyRotation(std::span<const glm::vec2> points, std::span<glm::vec2> out) const {
+        const float cosR = orientation.x;
+        const float sinR = orientation.y;
+        for (size_t i = 0; i < points.size(); i++) {
+            glm::vec2 point = points[i];
+            out[i] = glm::vec2(point.x * cosR - point.y * sinR, point.x * sinR + point.y * cosR);
         }
-        return result;
     }
 
-    std::vector<glm::vec2> ApplyPosition(std::vector<glm::vec2> points) const {
-        std::vector<glm::vec2> result;
-        for (glm::vec2 point : points) {
-            point += position + offset;
-            result.push_back(point);
+    // Vertices of many transforms in one pass: points[i] through transforms[i],
+    // written back to back into out (sum of every points[i].size()).
+    static void ApplyBatch(std::span<const Transform2D* const> transforms, std::span<const std::span<const glm::vec2>> points, std::span<glm::vec2> out) {
+        size_t written = 0;
+        for (size_t i = 0; i < transforms.size(); i++) {
+            transforms[i]->Apply(points[i], out.subspan(written, points[i].size()));
+            written += points[i].size();
         }
+    }
+
+    glm::vec2 Apply(glm::vec2 point) const {
+        glm::vec2 result;
+        Apply({&point, 1}, {&result, 1});
         return result;
     }
 
-    std::vector<glm::vec2> ApplyRotation(std::vector<glm::vec2> points) const {
-        std::vector<glm::vec2> result;
-        float rad = deg2rad(rotation);
-        float cosR = std::cos(rad);
-        float sinR = std::sin(rad);
-        for (glm::vec2 point : points) {
-            glm::vec2 rotated{
-                point.x * cosR - point.y * sinR,
-                point.x * sinR + point.y * cosR
-            };
-            point = rotated;
-            result.push_back(point);
-        }
+    std::vector<glm::vec2> Apply(const std::vector<glm::vec2>& points) const {
+        std::vector<glm::vec2> result(points.size());
+        Apply(points, result);
+        return result;
+    }
+
+    std::vector<glm::vec2> ApplyScale(const std::vector<glm::vec2>& points) const {
+        std::vector<glm::vec2> result(points.size());
+        ApplyScale(points, result);
+        return result;
+    }
+
+    std::vector<glm::vec2> ApplyPosition(const std::vector<glm::vec2>& points) const {
+        std::vector<glm::vec2> result(points.size());
+        ApplyPosition(points, result);
+        return result;
+    }
+
+    std::vector<glm::vec2> ApplyRotation(const std::vector<glm::vec2>& points) const {
+        std::vector<glm::vec2> result(points.size());
+        ApplyRotation(points, result);
         return result;
     }
  
@@ -65,7 +117,17 @@ public:
         offset(_offset),
         position(_position),
         scale(_scale),
-        rotation(_rotation)
+        orientation(orientation_from_degrees(_rotation))
     {}
-    ~Transform2D() = default;
+    ~Transform2D();     // leaves its hierarchy, children keep their pose as roots (TransformHierarchy.cpp)
+
+private:
+    friend class TransformHierarchy;
+    TransformHierarchy* hierarchy = nullptr;
+    Transform2D* parent = nullptr;
+    uint32_t node = UINT32_MAX;         // index in TransformHierarchy::Nodes
+    glm::vec2 localPosition{0.0f};      // in the parent's scaled and rotated frame
+    glm::vec2 localOrientation{1.0f, 0.0f};
+    glm::vec2 localScale{1.0f};
+    bool localDirty = false;
 };
@@ -0,0 +1,158 @@
+#include "TransformHierarchy.hpp"
+#include <algorithm>
+#include <limits>
+
+/*
+Dirty propagation in one pass over Nodes (sorted by depth, so a parent is always visited first):
+    root    moved = pose != cached pose
+    child   moved = parent moved || local pose set since the last pass
+            world = parent world * local   (position: parent origin + R(parent) * (parent scale * local position))
+Only moved nodes touch their Transform2D; the broadphase reads the poses right after (CollisionSystem::Detect).
+*/
+
+Transform2D::~Transform2D()
+{
+    if (hierarchy) hierarchy->Remove(this);
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+    Clear();
+}
+
+static glm::vec2 Origin(const Transform2D* transform) {
+    return transform->position + transform->offset;
+}
+
+uint32_t TransformHierarchy::AddNode(Transform2D* transform)
+{
+    if (transform->hierarchy == this) return transform->node;
+    transform->hierarchy = this;
+    transform->node = uint32_t(Nodes.size());
+    Nodes.push_back({transform, UINT32_MAX});
+    Sorted = false;
+    return transform->node;
+}
+
+bool TransformHierarchy::Attach(Transform2D* child, Transform2D* parent)
+{
+    if (!child || !parent) return false;
+    if ((child->hierarchy && child->hierarchy != this) || (parent->hierarchy && parent->hierarchy != this)) return false;
+    for (const Transform2D* t = parent; t; t = t->parent) {
+        if (t == child) return false;
+    }
+
+    AddNode(parent);
+    AddNode(child);
+
+    // Local pose that reproduces the current world pose under the parent
+    const glm::vec2 scale = glm::vec2(
+        parent->scale.x != 0.0f ? 1.0f / parent->scale.x : 0.0f,
+        parent->scale.y != 0.0f ? 1.0f / parent->scale.y : 0.0f);
+    child->localPosition = rotate_world_to_local(child->position - Origin(parent), parent->orientation) * scale;
+    child->localOrientation = rotate_world_to_local(child->orientation, parent->orientation);
+    child->localScale = child->scale * scale;
+    child->localDirty = true;
+    child->parent = parent;
+    Sorted = false;
+    return true;
+}
+
+void TransformHierarchy::Detach(Transform2D* child)
+{
+    if (!child || child->hierarchy != this || !child->parent) return;
+    child->parent = nullptr;
+    Sorted = false;
+}
+
+void TransformHierarchy::Remove(Transform2D* transform)
+{
+    // Rare (destruction of a linked transform): a scan finds the children
+    for (Node& node : Nodes) {
+        if (node.transform && node.transform->parent == transform) node.transform->parent = nullptr;
+    }
+    Nodes[transform->node].transform = nullptr;
+    transform->hierarchy = nullptr;
+    transform->parent = nullptr;
+    Sorted = false;
+}
+
+void TransformHierarchy::Clear()
+{
+    for (Node& node : Nodes) {
+        if (!node.transform) continue;
+        node.transform->hierarchy = nullptr;
+        node.transform->parent = nullptr;
+        node.transform->node = UINT32_MAX;
+    }
+    Nodes.clear();
+    Sorted = false;     // links changed: the next Update() reports it
+}
+
+void TransformHierarchy::Rebuild()
+{
+    // Drop destroyed nodes and roots left without children
+    std::vector<bool> hasChildren(Nodes.size(), false);
+    for (const Node& node : Nodes) {
+        if (node.transform && node.transform->parent) hasChildren[node.transform->parent->node] = true;
+    }
+
+    std::vector<std::pair<uint32_t, Transform2D*>> order;     // (depth, transform), stable in node order
+    order.reserve(Nodes.size());
+    for (size_t i = 0; i < Nodes.size(); i++) {
+        Transform2D* transform = Nodes[i].transform;
+        if (!transform) continue;
+        if (!transform->parent && !hasChildren[i]) {
+            transform->hierarchy = nullptr;
+            transform->node = UINT32_MAX;
+            continue;
+        }
+        uint32_t depth = 0;
+        for (const Transform2D* t = transform->parent; t; t = t->parent) depth++;
+        order.push_back({depth, transform});
+    }
+    std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Every node counts as moved on the next pass
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    Nodes.resize(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        Nodes[i] = {order[i].second, UINT32_MAX, glm::vec2(nan), glm::vec2(nan), glm::vec2(nan), false};
+        order[i].second->node = uint32_t(i);
+        order[i].second->localDirty = true;
+    }
+    for (Node& node : Nodes) {
+        if (node.transform->parent) node.parent = node.transform->parent->node;
+    }
+    Sorted = true;
+}
+
+bool TransformHierarchy::Update()
+{
+    const bool rebuilt = !Sorted;
+    if (rebuilt) Rebuild();
+    Updated = 0;
+
+    for (Node& node : Nodes) {
+        Transform2D* t = node.transform;
+        if (node.parent == UINT32_MAX) {
+            node.moved = Origin(t) != node.position || t->orientation != node.orientation || t->scale != node.scale;
+        }
+        else {
+            const Node& parent = Nodes[node.parent];
+            node.moved = parent.moved || t->localDirty;
+            if (!node.moved) continue;
+
+            t->position = parent.position + rotate_local_to_world(parent.scale * t->localPosition, parent.orientation);
+            t->orientation = rotate_local_to_world(t->localOrientation, parent.orientation);
+            t->scale = parent.scale * t->localScale;
+            t->localDirty = false;
+            Updated++;
+        }
+        if (!node.moved) continue;
+        node.position = Origin(t);
+        node.orientation = t->orientation;
+        node.scale = t->scale;
+    }
+    return rebuilt;
+}
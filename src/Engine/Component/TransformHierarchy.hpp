@@ -0,0 +1,49 @@
+#pragma once
+#include "Transform2D.hpp"
+#include <vector>
+
+// Parent / child links between transforms (turrets, wheels, attached parts). A child's world pose
+// is cached in its Transform2D and only recomputed when its local pose was set or an ancestor
+// moved. Roots are moved by anyone (solver, game code), so a root counts as moved when its pose
+// differs from the one cached at the last Update(). Nodes are kept sorted parents first, so an
+// update is one linear pass; the order is rebuilt only after Attach / Detach / destruction.
+// Scale composes per axis: a rotated child under a non-uniform parent scale is not sheared.
+// A rigid body attached as a child is static while attached (RigidBodyStore::Attached, synced by its
+// world when the links change): the hierarchy poses it, it pushes what it touches and gains no velocity.
+class TransformHierarchy {
+public:
+    TransformHierarchy() = default;
+    ~TransformHierarchy();
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+    // The child keeps its current world pose, its local pose is derived from it.
+    // False (nothing changed) for a cycle or a transform owned by another hierarchy.
+    bool Attach(Transform2D* child, Transform2D* parent);
+    void Detach(Transform2D* child);    // keeps its world pose, its own children follow it
+    void Clear();                       // detaches everything
+
+    // Writes the world pose of every child whose parent chain or local pose changed.
+    // True when the links changed since the last call (order rebuilt).
+    bool Update();
+
+    size_t Size() const { return Nodes.size(); }
+    uint32_t Updated = 0;       // children recomputed by the last Update()
+
+private:
+    friend class Transform2D;
+    void Remove(Transform2D* transform);
+    void Rebuild();
+    uint32_t AddNode(Transform2D* transform);
+
+    struct Node {
+        Transform2D* transform = nullptr;   // null once destroyed, dropped by the next Rebuild()
+        uint32_t parent = UINT32_MAX;       // node index, UINT32_MAX for roots
+        glm::vec2 position = glm::vec2(0.0f);   // world pose at the last Update() (origin: position + offset)
+        glm::vec2 orientation = glm::vec2(0.0f);
+        glm::vec2 scale = glm::vec2(0.0f);
+        bool moved = false;
+    };
+    std::vector<Node> Nodes;        // parents before children
+    bool Sorted = true;
+};
@@ -0,0 +1,42 @@
+#include "FrameArena.hpp"
+#include <algorithm>
+
+FrameArena::FrameArena(size_t capacity) :
+    Block(new std::byte[capacity]),
+    Size(capacity)
+{
+    Overflow.reserve(16);
+}
+
+void* FrameArena::Allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t base = reinterpret_cast<uintptr_t>(Block.get());
+    size_t aligned = ((base + Offset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - base;
+
+    if (aligned + bytes <= Size) {
+        Offset = aligned + bytes;
+        return Block.get() + aligned;
+    }
+
+    // Overflow: a dedicated heap block for this request, folded into the main block on Reset()
+    Overflow.emplace_back(new std::byte[bytes + alignment]);
+    Allocations++;
+    OverflowBytes += bytes + alignment;
+    uintptr_t raw = reinterpret_cast<uintptr_t>(Overflow.back().get());
+    return reinterpret_cast<void*>((raw + alignment - 1) & ~(uintptr_t(alignment) - 1));
+}
+
+void FrameArena::Reset()
+{
+    PeakBytes = std::max(PeakBytes, Offset + OverflowBytes);
+    Offset = 0;
+    OverflowBytes = 0;
+    Allocations = 0;
+
+    if (!Overflow.empty()) {
+        Overflow.clear();
+        Size = PeakBytes + PeakBytes / 2;
+        Block.reset(new std::byte[Size]);
+        Allocations++;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// Linear allocator for per-step temporaries: bump allocate, release everything at once with Reset().
+// When the block runs out, extra blocks come from the heap and the next Reset() grows the block
+// to the peak, so a steady-state frame never touches the heap.
+// Not thread safe, spans are valid until the next Reset().
+class FrameArena {
+public:
+    FrameArena() : FrameArena(256 * 1024) {}
+    explicit FrameArena(size_t capacity);
+
+    void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    // Uninitialized storage for trivially destructible types, fill before reading
+    template <typename T>
+    std::span<T> Allocate(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+        if (count == 0) return {};
+        return {static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))), count};
+    }
+
+    void Reset();
+
+    size_t Used() const { return Offset + OverflowBytes; }
+    size_t Capacity() const { return Size; }
+    size_t Peak() const { return PeakBytes; }
+    uint32_t HeapAllocations() const { return Allocations; }   // since the last Reset(), 0 in steady state
+
+private:
+    std::unique_ptr<std::byte[]> Block;
+    size_t Size = 0;
+    size_t Offset = 0;
+
+    std::vector<std::unique_ptr<std::byte[]>> Overflow;
+    size_t OverflowBytes = 0;
+    size_t PeakBytes = 0;
+    uint32_t Allocations = 0;
+};
@@ -0,0 +1,124 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+#include <mutex>
+#include <type_traits>
+
+// Generational reference to a pooled object: stale once the object is destroyed,
+// even if its slot has been reused since.
+template <typename T>
+struct Handle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(const Handle& other) const = default;
+};
+
+// Typed slab allocator: fixed size blocks of contiguous slots, O(1) allocate / free
+// through an intrusive free list. Slots never move, so pointers stay valid while alive.
+// One pool per type for the whole process: the free list and the block table are locked,
+// so worlds on different threads can create, destroy and resolve objects at the same time.
+template <typename T, size_t BlockSize = 1024>
+class ObjectPool {
+public:
+    static ObjectPool& Instance() {
+        static ObjectPool pool;
+        return pool;
+    }
+
+    void* Allocate() {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (FreeHead == UINT32_MAX) Grow();
+        Slot& slot = SlotAt(FreeHead);
+        FreeHead = slot.nextFree;
+        slot.alive = true;
+        Live++;
+        return slot.storage;
+    }
+
+    void Free(void* pointer) {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Slot& slot = *reinterpret_cast<Slot*>(pointer);
+        slot.alive = false;
+        slot.generation++;              // invalidates every handle to this slot
+        slot.nextFree = FreeHead;
+        FreeHead = slot.index;
+        Live--;
+    }
+
+    // Reads the object's own slot only (the caller owns the object), no lock
+    Handle<T> HandleOf(const T* object) const {
+        const Slot& slot = *reinterpret_cast<const Slot*>(object);
+        return {slot.index, slot.generation};
+    }
+
+    T* Resolve(Handle<T> handle) const {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (handle.index >= Blocks.size() * BlockSize) return nullptr;
+        const Slot& slot = SlotAt(handle.index);
+        if (!slot.alive || slot.generation != handle.generation) return nullptr;
+        return std::launder(reinterpret_cast<T*>(const_cast<std::byte*>(slot.storage)));
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(Mutex);
+        return Live;
+    }
+
+    size_t Capacity() const {
+        std::lock_guard<std::mutex> lock(Mutex);
+        return Blocks.size() * BlockSize;
+    }
+
+private:
+    // Storage first: the object address is the slot address
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+        uint32_t index;
+        uint32_t generation;
+        uint32_t nextFree;
+        bool alive;
+    };
+
+    Slot& SlotAt(uint32_t index) const { return Blocks[index / BlockSize][index % BlockSize]; }
+
+    void Grow() {
+        const uint32_t first = static_cast<uint32_t>(Blocks.size() * BlockSize);
+        Blocks.emplace_back(new Slot[BlockSize]);
+        Slot* block = Blocks.back().get();
+        for (uint32_t i = 0; i < BlockSize; i++) {
+            block[i].index = first + i;
+            block[i].generation = 0;
+            block[i].alive = false;
+            block[i].nextFree = (i + 1 < BlockSize) ? first + i + 1 : FreeHead;
+        }
+        FreeHead = first;
+    }
+
+    mutable std::mutex Mutex;
+    std::vector<std::unique_ptr<Slot[]>> Blocks;
+    uint32_t FreeHead = UINT32_MAX;
+    size_t Live = 0;
+};
+
+// Mixin routing `new T` / `delete` through ObjectPool<T>.
+// T must be final: handles are read from the pool slot around the object, which a
+// subclass (bigger, allocated elsewhere) would not have.
+template <typename T>
+class Pooled {
+public:
+    static void* operator new(size_t) {
+        static_assert(std::is_final_v<T>, "Pooled types are final, extend them by composition");
+        return ObjectPool<T>::Instance().Allocate();
+    }
+
+    static void operator delete(void* pointer) {
+        if (pointer) ObjectPool<T>::Instance().Free(pointer);
+    }
+
+    Handle<T> GetHandle() const { return ObjectPool<T>::Instance().HandleOf(static_cast<const T*>(this)); }
+    static T* Resolve(Handle<T> handle) { return ObjectPool<T>::Instance().Resolve(handle); }
+};
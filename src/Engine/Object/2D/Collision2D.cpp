@@ -7,22 +7,35 @@
 
 // Con/De structor
 Collision2D::Collision2D(
-    Shape2D* _shape,
+    PhysicsWorld& _world,
+    const Shape2D* _shape,
     glm::vec4 _color,
     glm::vec4 _outline_color,
     glm::vec4 _colliding_color
 ):
+world(&_world),
+id(_world.Collisions.NextId++),
 shape(_shape),
 color(_color),
 outline_color(_outline_color),
 colliding_color(_colliding_color)
 {
-    PhysicsServer::CollisionSystem::SpatialGrid->AddObject(this);
+    if (shape) shape->Retain();
+    world->Collisions.SpatialGrid.AddObject(this);
 }
 
+Collision2D::Collision2D(
+    const Shape2D* _shape,
+    glm::vec4 _color,
+    glm::vec4 _outline_color,
+    glm::vec4 _colliding_color
+):
+Collision2D(PhysicsServer::World(), _shape, _color, _outline_color, _colliding_color)
+{}
+
 Collision2D::~Collision2D() {
-    PhysicsServer::CollisionSystem::SpatialGrid->RemoveObject(this);
-    if (shape) delete shape;
+    world->Collisions.SpatialGrid.RemoveObject(this);
+    if (shape) shape->Release();
 }
 
 // Methods
@@ -39,35 +52,77 @@ std::vector<Edge2D> Collision2D::getEdges() {
     return edges;
 }
 
+std::span<glm::vec2> Collision2D::getVertices(FrameArena& arena) {
+    std::span<glm::vec2> verts = arena.Allocate<glm::vec2>(shape->vertices.size());
+    transform->Apply(shape->vertices, verts);
+    return verts;
+}
+
+std::span<Edge2D> Collision2D::getEdges(FrameArena& arena) {
+    std::span<glm::vec2> verts = getVertices(arena);
+    std::span<Edge2D> edges = arena.Allocate<Edge2D>(verts.size());
+    for (size_t i = 0; i < verts.size(); i++) {
+        std::construct_at(&edges[i], verts[i], verts[(i + 1) % verts.size()]);
+    }
+    return edges;
+}
+
 glm::vec2 Collision2D::getCenter() {
-    return transform->Apply({shape->center})[0];
+    return transform->Apply(shape->center);
+}
+
+// World vertices through a small stack buffer, for the queries that only stream over them
+template <typename Visit>
+static void ForEachWorldVertex(const Transform2D* transform, std::span<const glm::vec2> vertices, Visit visit) {
+    glm::vec2 buffer[32];
+    for (size_t first = 0; first < vertices.size(); first += std::size(buffer)) {
+        std::span<const glm::vec2> chunk = vertices.subspan(first, std::min(std::size(buffer), vertices.size() - first));
+        transform->Apply(chunk, buffer);
+        for (size_t i = 0; i < chunk.size(); i++) visit(buffer[i]);
+    }
 }
 
 AABB Collision2D::getBounds() {
-    return AABB(getVertices());
+    if (shape->vertices.empty()) return AABB();
+
+    glm::vec2 min(std::numeric_limits<float>::max());
+    glm::vec2 max(std::numeric_limits<float>::lowest());
+    ForEachWorldVertex(transform, shape->vertices, [&](glm::vec2 v) {
+        min = glm::min(min, v);
+        max = glm::max(max, v);
+    });
+    return AABB::FromMinMax(min, max);
 }
 
 bool Collision2D::hasPoint(glm::vec2 point) {
     bool inside = false;
-    std::vector<glm::vec2> polygon = getVertices();
-    int n = polygon.size();
-    for (int i = 0, j = n - 1; i < n; j = i++) {
-        if (((polygon[i].y > point.y) != (polygon[j].y > point.y)) &&
-            (point.x < (polygon[j].x - polygon[i].x) * (point.y - polygon[i].y) / 
-                      (polygon[j].y - polygon[i].y) + polygon[i].x)) {
+    const std::vector<glm::vec2>& polygon = shape->vertices;
+    if (polygon.empty()) return false;
+    glm::vec2 pj = transform->Apply(polygon.back());
+    ForEachWorldVertex(transform, polygon, [&](glm::vec2 pi) {
+        if (((pi.y > point.y) != (pj.y > point.y)) &&
+            (point.x < (pj.x - pi.x) * (point.y - pi.y) / 
+                      (pj.y - pi.y) + pi.x)) {
             inside = !inside;
         }
-    }
+        pj = pi;
+    });
     return inside;
 }
 
-void Collision2D::OnDraw() {
-    std::vector<glm::vec2> verts = getVertices();
+void Collision2D::Draw() {
+    // Reused between draws: no allocation once it fits the largest shape
+    static std::vector<glm::vec2> verts;
+    verts.resize(shape->vertices.size());
+    transform->Apply(shape->vertices, verts);
+    if (verts.empty()) return;
+
     if (info.isColliding) Renderer2D::DrawPolygon(verts, colliding_color);
     else Renderer2D::DrawPolygon(verts, color);
     Renderer2D::DrawLines(verts, outline_color);
-    Renderer2D::DrawLines({verts[0], transform->position}, outline_color);
-    for (auto& [other, contacts] : info.ContactPoints) {
+    const glm::vec2 radius[2] = {verts[0], transform->position};
+    Renderer2D::DrawLines(std::span<const glm::vec2>(radius), outline_color);
+    for (std::span<const glm::vec2> contacts : info.ContactPoints) {
         Renderer2D::DrawPoints(contacts, {1, 0, 0, 1}, 10.0f);
     }
 }
@@ -1,47 +1,89 @@
 #pragma once
 #include "Object2D.hpp"
+#include <Engine/Memory/ObjectPool.hpp>
+#include <Engine/Memory/FrameArena.hpp>
+#include <span>
 
 class Collision2D;
+class PhysicsWorld;
 
+// Rebuilt by every detection pass inside PhysicsWorld::Arena: valid until the world's next Update()
 struct Collision2DInfos {
-    // Constructor
-    Collision2DInfos() :
-        isColliding(false),
-        Colliders({}),
-        isPhysicsColliding(false),
-        PhysicsColliders({}),
-        MTV({}),
-        ContactPoints({})
-    {}
-
     // Properties
     // Standard Collision Infos
-    bool isColliding;
-    std::vector<Collision2D*> Colliders;
-
-    // Physics Body Collision Infos
-    bool isPhysicsColliding;
-    std::vector<Collision2D*> PhysicsColliders;
-    std::unordered_map<Collision2D*, glm::vec2> MTV; // Minimum translation Vector
-    std::unordered_map<Collision2D*, std::vector<glm::vec2>> ContactPoints;
+    bool isColliding = false;
+    std::span<Collision2D*> Colliders;
+
+    // Physics Body Collision Infos, one entry per physics collider (parallel arrays)
+    bool isPhysicsColliding = false;
+    std::span<Collision2D*> PhysicsColliders;
+    std::span<glm::vec2> MTV; // Minimum translation Vector
+    std::span<std::span<const glm::vec2>> ContactPoints;
+    std::span<float> Impulse;   // normal impulse the solver applied on the pair so far (see ContactSystem)
+
+    // Index of other in the physics arrays, -1 if they are not touching
+    int Find(const Collision2D* other) const {
+        for (size_t i = 0; i < PhysicsColliders.size(); i++)
+            if (PhysicsColliders[i] == other) return int(i);
+        return -1;
+    }
+};
+
+// Kind of body owning a collider, tagged by the body constructors so hot loops branch without RTTI
+enum class BodyKind2D : uint8_t {
+    None,       // bare collider (overlap queries only)
+    Static,     // any non rigid PhysicsBody2D
+    Rigid
 };
 
-class Collision2D : public Object2D {
+// Broadphase filter: a and b are tested when (a.category & b.mask) && (b.category & a.mask).
+// A shared non zero group overrides the masks: positive always collides, negative never.
+struct CollisionFilter2D {
+    uint32_t category = 1;
+    uint32_t mask = 0xFFFFFFFFu;
+    int16_t group = 0;
+
+    static bool ShouldCollide(const CollisionFilter2D& a, const CollisionFilter2D& b) {
+        if (a.group == b.group && a.group != 0) return a.group > 0;
+        return (a.category & b.mask) && (b.category & a.mask);
+    }
+};
+
+class Collision2D final : public Object2D, public Pooled<Collision2D> {
+    friend class CollisionSpatialGrid;
 public:
     // Con/De structor
     Collision2D(
-        Shape2D* _shape,
+        PhysicsWorld& _world,
+        const Shape2D* _shape,
+        glm::vec4 _color = {1.0f, 1.0f, 1.0f, 1.0f},
+        glm::vec4 _outline_color = {0.0f, 0.0f, 0.0f, 1.0f},
+        glm::vec4 _colliding_color = {1.0f, 0.0f, 0.0f, 1.0f}
+    );
+    // Joins the default world (PhysicsServer::World())
+    Collision2D(
+        const Shape2D* _shape,
         glm::vec4 _color = {1.0f, 1.0f, 1.0f, 1.0f},
         glm::vec4 _outline_color = {0.0f, 0.0f, 0.0f, 1.0f},
         glm::vec4 _colliding_color = {1.0f, 0.0f, 0.0f, 1.0f}
     );
     ~Collision2D();
 
+    // Owning world (broadphase), bodies built on this collider join it too
+    PhysicsWorld* const world;
+
     // PhysicsBody (Parent)
     Object2D* PHYSICS_PARENT = nullptr;
+    BodyKind2D bodyKind = BodyKind2D::None;     // what PHYSICS_PARENT is
+
+    // Layers, checked by the broadphase before any narrowphase work
+    CollisionFilter2D filter;
+
+    // Creation order within the world, stable across runs (deterministic pair ordering)
+    const uint32_t id;
 
     // Properties
-    Shape2D* shape;
+    const Shape2D* shape;     // shared, see ShapeLibrary
     glm::vec4 color;
     glm::vec4 outline_color;
     glm::vec4 colliding_color;
@@ -50,9 +92,15 @@ public:
     // Methods
     std::vector<glm::vec2> getVertices();
     std::vector<Edge2D> getEdges();
+    std::span<glm::vec2> getVertices(FrameArena& arena);    // physics temporaries
+    std::span<Edge2D> getEdges(FrameArena& arena);
     glm::vec2 getCenter();
     AABB getBounds();
     bool hasPoint(glm::vec2 point);
 
-    void OnDraw() override;
+    void Draw();    // non virtual, for batch draw systems (see SystemServer)
+    void OnDraw() override { Draw(); }
+
+private:
+    uint32_t gridIndex = UINT32_MAX;    // slot in the world's CollisionSpatialGrid::Objects
 };
@@ -9,7 +9,6 @@ public:
     }
 
     ~Object2D() {
-        transform = new Transform2D();
         delete transform;
     }
 
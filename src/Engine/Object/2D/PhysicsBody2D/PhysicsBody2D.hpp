@@ -9,19 +9,29 @@ public:
     PhysicsBody2D(Collision2D* _collision): collision(_collision) {
         if (collision) {
             collision->PHYSICS_PARENT = this;
+            collision->bodyKind = BodyKind2D::Static;     // RigidBody2D retags it
+            // The collision follows the body transform, its own is dropped
+            delete collision->transform;
             collision->transform = this->transform;
         }
     }
     ~PhysicsBody2D() {
-        collision = new Collision2D(new Shape2D());
-        delete collision;
+        if (collision) {
+            collision->transform = nullptr;     // shared, released by this body
+            delete collision;
+        }
     };
 
     // Properties
     Collision2D* collision;
 
+    // Body of a collider from its kind tag (no RTTI), null for bare colliders
+    static PhysicsBody2D* FromCollision(const Collision2D* col) {
+        return col->bodyKind != BodyKind2D::None ? static_cast<PhysicsBody2D*>(col->PHYSICS_PARENT) : nullptr;
+    }
+
     // GameLoop
     void OnDraw() override {
-        if (collision) collision->OnDraw();
+        if (collision) collision->Draw();
     }
 };
@@ -16,26 +16,27 @@ RigidBody2D::RigidBody2D(
 )
     :
     PhysicsBody2D(_collision),
-    mass(_mass),
-    restitution(_restitution),
-    friction(_friction),
-    gravityScale(_gravityScale),
-    linearDamping(_linearDamping),
-    angularDamping(_angularDamping),
-    canSleep(_canSleep),
-    isSleeping(_isSleeping),
-    isStatic(_isStatic)
+    store(&(_collision ? *_collision->world : PhysicsServer::World()).RigidBodies.Store)
 {
-    linearVelocity = glm::vec2(0.0f);
-    angularVelocity = 0.0f;
+    if (collision) collision->bodyKind = BodyKind2D::Rigid;
+    id = store->Add(this, transform);
 
-    acceleration = glm::vec2(0.0f);
-    angularAcceleration = 0.0f;
+    store->gravityScale[id] = _gravityScale;
+    store->linearDamping[id] = _linearDamping;
+    store->angularDamping[id] = _angularDamping;
+    setRestitution(_restitution);
+    setFriction(_friction);
 
-    glm::clamp(restitution, 0.0f, 1.0f);
-    glm::clamp(friction, 0.0f, 1.0f);
+    store->SetFlag(id, RigidBodyStore::CanSleep, _canSleep);
+    store->SetFlag(id, RigidBodyStore::Sleeping, _isSleeping);
+    store->SetFlag(id, RigidBodyStore::Static, _isStatic);
 
-    CalculateInertia();
+    setMass(_mass);
+}
+
+RigidBody2D::~RigidBody2D()
+{
+    store->Remove(id);
 }
 
 /*
@@ -56,42 +57,51 @@ d: damping
 */
 
 // ----------------- Inertia --------------------
+void RigidBody2D::setMass(float _mass)
+{
+    store->mass[id] = _mass;
+    store->inverseMass[id] = (IsStatic() || _mass <= 0.0f) ? 0.0f : 1.0f / _mass;
+    CalculateInertia();
+}
+
 void RigidBody2D::CalculateInertia()
 {
-    if (isStatic || mass <= 0.0f) {
-        inertia = 0.0f;
-        return;
-    }
+    const float mass = getMass();
+    float inertia = 0.0f;
 
-    if (collision) {
+    if (!IsStatic() && mass > 0.0f && collision) {
         // Rectangle: I = (1/12) * m * (w² + h²)
-        if (Box2D* box = dynamic_cast<Box2D*>(collision->shape)) {
-            float w = box->w;
-            float h = box->h;
+        const glm::vec2 scale = glm::abs(transform->scale);
+        if (const Box2D* box = dynamic_cast<const Box2D*>(collision->shape)) {
+            float w = box->w * scale.x;
+            float h = box->h * scale.y;
             inertia = mass * (w * w + h * h) / 12.0f;
         }
         // Circle inertia: I = (1/2) * m * r²
-        else if (Circle2D* circle = dynamic_cast<Circle2D*>(collision->shape)) {
-            inertia = 0.5f * mass * (circle->radius * circle->radius);
+        else if (const Circle2D* circle = dynamic_cast<const Circle2D*>(collision->shape)) {
+            float radius = circle->radius * std::max(scale.x, scale.y);
+            inertia = 0.5f * mass * (radius * radius);
         }
     }
-}
 
-float RigidBody2D::getInertia() {return inertia;}
+    store->inertia[id] = inertia;
+    store->inverseInertia[id] = (inertia > 0.0f) ? 1.0f / inertia : 0.0f;
+}
 
 // ------------- Forces & Impulses --------------
 
 void RigidBody2D::WakeUp()
 {
     std::cout << "Waky Waky" << std::endl; // IDK it seems cool for debugging :)
-    isSleeping = false;
+    store->SetFlag(id, RigidBodyStore::Sleeping, false);
 }
 
 void RigidBody2D::ApplyForce(const glm::vec2 force, const glm::vec2 point)
 {
     // Newton’s 2nd law: F = m * a  =>  a = F / m
-    if (isStatic || isSleeping) return;
-    acceleration += force / mass;
+    if (IsStatic() || IsSleeping()) return;
+    store->accelerationX[id] += force.x * getInverseMass();
+    store->accelerationY[id] += force.y * getInverseMass();
 
     if (point != glm::vec2(0.0f)) {
         // Torque from force:
@@ -111,102 +121,47 @@ void RigidBody2D::ApplyImpulse(const glm::vec2 impulse, const glm::vec2 point)
     // Angular impulse:
     // L = r * J
 
-    if (isStatic || isSleeping) return;
+    if (IsStatic() || IsSleeping()) return;
 
     // v = J / m
-    linearVelocity += impulse / mass;
+    store->velocityX[id] += impulse.x * getInverseMass();
+    store->velocityY[id] += impulse.y * getInverseMass();
 
-    if (inertia > 0.0f && point != glm::vec2(0.0f)) {
+    if (getInverseInertia() > 0.0f && point != glm::vec2(0.0f)) {
         // w = L / I
         float angularImpulse = point.x * impulse.y - point.y * impulse.x;
-        angularVelocity += angularImpulse / inertia;
+        store->angularVelocity[id] += angularImpulse * getInverseInertia();
     }
 }
 
-void RigidBody2D::ApplyTorque(float torque)
+void RigidBody2D::ApplyAngularImpulse(float impulse)
 {
-    // Rotational Newton’s 2nd law: t = I * α => α = t / I
-    if (isStatic || isSleeping || inertia <= 0.0f) return;
-    angularAcceleration += torque / inertia;
+    // w = L / I
+    if (IsStatic() || IsSleeping()) return;
+    store->angularVelocity[id] += impulse * getInverseInertia();
 }
 
-// ---------------- Integration -----------------
-void RigidBody2D::IntegrateForces(float delta)
+void RigidBody2D::ApplyTorque(float torque)
 {
-    if (isStatic || isSleeping) return;
-
-    // Linear velocity update
-    // v += a * dt
-    linearVelocity += acceleration * delta;
-
-    // Angular velocity update
-    // w += α * dt
-    angularVelocity += angularAcceleration * delta;
-
-    // Damping (decay)
-    // v /= (1 + d * dt)
-    // w /= (1 + d * dt)
-    linearVelocity *= 1.0f / (1.0f + linearDamping * delta);
-    angularVelocity *= 1.0f / (1.0f + angularDamping * delta);
-
-    if (glm::length2(linearVelocity) < 1e-4f) 
-        linearVelocity = glm::vec2(0.0f);
-    if (std::abs(angularVelocity) < 1e-4f)
-        angularVelocity = 0.0f;
-
-    // Reset accumulators
-    acceleration = glm::vec2(0.0f);
-    angularAcceleration = 0.0f;
+    // Rotational Newton’s 2nd law: t = I * α => α = t / I
+    if (IsStatic() || IsSleeping() || getInverseInertia() <= 0.0f) return;
+    store->angularAcceleration[id] += torque * getInverseInertia();
 }
 
-void RigidBody2D::IntegrateVelocities(float delta)
-{
-    if (isStatic || isSleeping) return;
-
-    // Position update
-    // x += v * dt
-    transform->position += linearVelocity * delta;
-
-    // Rotation update
-    // o += w * dt
-    transform->rotation += rad2deg(angularVelocity * delta);
-    while (transform->rotation >= 360.0) {
-        transform->rotation -= 360.0;
-    }
-}
+// ---------------- Integration -----------------
+// Integration runs in batch over the whole RigidBodyStore
+// (see RigidBodyStore::IntegrateForces / IntegrateVelocities)
 
 // TODO
 void RigidBody2D::checkSleep()
 {
-    if (!canSleep) return;
-    if (glm::length2(linearVelocity) < sleepLinearThreshold * sleepLinearThreshold &&
-        std::abs(angularVelocity) < sleepAngularThreshold) 
+    if (!CanSleep()) return;
+    if (glm::length2(getLinearVelocity()) < sleepLinearThreshold * sleepLinearThreshold &&
+        std::abs(getAngularVelocity()) < sleepAngularThreshold) 
     {
         std::cout << "sleeps" << std::endl;
-        isSleeping = true;
-        linearVelocity = glm::vec2(0.0f);
-        angularVelocity = 0.0f;
-    }
-}
-
-// --------- RigidBody Physics Updates ----------
-void RigidBody2D::MoveAndCollide(float delta)
-{
-    if (isStatic || isSleeping) return;
-
-    ApplyForce(PhysicsServer::Gravity * PhysicsServer::GravityDirection * mass * gravityScale);
-    
-    IntegrateForces(delta);
-
-    if (collision->info.isPhysicsColliding) {
-        PhysicsServer::RigidBodySystem::Solve(this, collision->info);
+        store->SetFlag(id, RigidBodyStore::Sleeping, true);
+        setLinearVelocity(glm::vec2(0.0f));
+        setAngularVelocity(0.0f);
     }
-
-    IntegrateVelocities(delta);
-}
-
-// GameLoop
-void RigidBody2D::OnUpdate(float delta)
-{
-    MoveAndCollide(delta);
 }
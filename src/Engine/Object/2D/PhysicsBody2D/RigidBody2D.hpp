@@ -1,22 +1,11 @@
 #pragma once
 #include "PhysicsBody2D.hpp"
+#include <Engine/Servers/PhysicsServer/RigidBodyStore.hpp>
 
-class RigidBody2D : public PhysicsBody2D {
+// Thin handle over a slot of the RigidBodyStore of its collider's world (see PhysicsWorld::RigidBodySystem)
+class RigidBody2D final : public PhysicsBody2D, public Pooled<RigidBody2D> {
+    friend class RigidBodyStore;
 public:
-    float mass;
-    bool isStatic;
-    bool isSleeping;
-    bool canSleep;
-
-    float restitution;      // bounciness [0,1]
-    float friction;         // surface friction coefficient [0, 1]
-    float gravityScale;
-
-    glm::vec2 linearVelocity;
-    float linearDamping;    // drag
-    float angularVelocity;
-    float angularDamping;   // angular drag
-
     RigidBody2D(
         Collision2D* _collision,
         float _mass = 1.0f,
@@ -28,37 +17,79 @@ public:
         bool _canSleep = false,
         bool _isSleeping = false,
         bool _isStatic = false);
-    ~RigidBody2D() = default;
+    ~RigidBody2D();
+
+    // Rigid body of a collider from its kind tag (no RTTI), null for static / bare colliders
+    static RigidBody2D* FromCollision(const Collision2D* col) {
+        return col->bodyKind == BodyKind2D::Rigid ? static_cast<RigidBody2D*>(col->PHYSICS_PARENT) : nullptr;
+    }
 
     // --- Forces & Impulses ---
     void WakeUp();
     void ApplyForce(const glm::vec2 force, const glm::vec2 point = glm::vec2(0.0f));
     void ApplyTorque(const float torque);
     void ApplyImpulse(const glm::vec2 impulse, const glm::vec2 point = glm::vec2(0.0f));
+    void ApplyAngularImpulse(const float impulse);
 
-    // --- Update steps ---
-    void IntegrateForces(float dt);
-    void IntegrateVelocities(float dt);
-    
     // --- Gets Functions --
-    float getInertia();
+    float getInertia() const { return store->inertia[id]; }
+    float getInverseInertia() const { return store->inverseInertia[id]; }
+    float getMass() const { return store->mass[id]; }
+    float getInverseMass() const { return store->inverseMass[id]; }
+    float getRestitution() const { return store->restitution[id]; }
+    float getFriction() const { return store->friction[id]; }
+    float getGravityScale() const { return store->gravityScale[id]; }
+    float getLinearDamping() const { return store->linearDamping[id]; }
+    float getAngularDamping() const { return store->angularDamping[id]; }
 
-    void MoveAndCollide(float delta);
+    glm::vec2 getPosition() const { return {store->positionX[id], store->positionY[id]}; }
+    float getRotation() const { return orientation_to_degrees(getOrientation()); }
+    glm::vec2 getOrientation() const { return {store->rotationCos[id], store->rotationSin[id]}; }
+    glm::vec2 getLinearVelocity() const { return {store->velocityX[id], store->velocityY[id]}; }
+    float getAngularVelocity() const { return store->angularVelocity[id]; }
 
-    // --- Update wrapper ---
-    void OnUpdate(float dt);
+    // --- Sets Functions --
+    void setMass(float _mass);
+    void setRestitution(float _restitution) { store->restitution[id] = glm::clamp(_restitution, 0.0f, 1.0f); }
+    void setFriction(float _friction) { store->friction[id] = glm::clamp(_friction, 0.0f, 1.0f); }
+    void setGravityScale(float _gravityScale) { store->gravityScale[id] = _gravityScale; }
+    void setLinearDamping(float _damping) { store->linearDamping[id] = _damping; }
+    void setAngularDamping(float _damping) { store->angularDamping[id] = _damping; }
+
+    void setPosition(glm::vec2 position) {
+        store->positionX[id] = position.x;
+        store->positionY[id] = position.y;
+        transform->position = position;
+    }
+    void setRotation(float degrees) { setOrientation(orientation_from_degrees(degrees)); }
+    void setOrientation(glm::vec2 orientation) {
+        store->rotationCos[id] = orientation.x;
+        store->rotationSin[id] = orientation.y;
+        transform->orientation = orientation;
+    }
+    // Small incremental turn (radians) for the position solvers, no trig
+    void Rotate(float radians) { setOrientation(integrate_rotation(getOrientation(), radians)); }
+    void setLinearVelocity(glm::vec2 velocity) {
+        store->velocityX[id] = velocity.x;
+        store->velocityY[id] = velocity.y;
+    }
+    void setAngularVelocity(float velocity) { store->angularVelocity[id] = velocity; }
 
     // --- Getters ---
-    bool IsStatic() const { return isStatic; }
+    bool IsStatic() const { return store->HasFlag(id, RigidBodyStore::Static) || store->HasFlag(id, RigidBodyStore::Attached); }    // also while attached to a parent transform
+    bool IsSleeping() const { return store->HasFlag(id, RigidBodyStore::Sleeping); }
+    bool CanSleep() const { return store->HasFlag(id, RigidBodyStore::CanSleep); }
+    uint32_t getStoreIndex() const { return id; }
 
-private:
+    // From the shape and the transform scale: call again after rescaling the body
     void CalculateInertia();
+
+private:
     void checkSleep();
 
     const float sleepLinearThreshold = 5.0f;
-    const float sleepAngularThreshold = 5.0f; 
+    const float sleepAngularThreshold = 5.0f;
 
-    float inertia;
-    glm::vec2 acceleration;
-    float angularAcceleration;
+    RigidBodyStore* store;
+    uint32_t id;
 };
@@ -13,7 +13,7 @@ public:
     Object() = default;
     virtual ~Object() = default;
 
-    // GameLoop
+    // GameLoop, one object at a time (work over every object of a type goes in a SystemServer system)
     virtual void OnReady() {};
     virtual void OnUpdate(float delta) {};
     virtual void OnPhysicsUpdate(float delta) {};
@@ -39,17 +39,17 @@ void Renderer2D::Delete() {
     Initialized = false;
 }
 
-void Renderer2D::DrawPolygon(const std::vector<glm::vec2>& vertices, const glm::vec4& color) {
-    std::vector<Triangle2D> triangles = Triangulator2D::FanTriangulation(vertices);
-    for (auto& t : triangles) {
+void Renderer2D::DrawPolygon(std::span<const glm::vec2> vertices, const glm::vec4& color) {
+    // Fan straight into the batch (see Triangulator2D::FanTriangulation)
+    for (size_t i = 1; i + 1 < vertices.size(); ++i) {
         if (vertexBatch.size() + 3 >= MAX_VERTICES) break;
-        vertexBatch.push_back({t.a, color});
-        vertexBatch.push_back({t.b, color});
-        vertexBatch.push_back({t.c, color});
+        vertexBatch.push_back({vertices[0], color});
+        vertexBatch.push_back({vertices[i], color});
+        vertexBatch.push_back({vertices[i + 1], color});
     }
 }
 
-void Renderer2D::DrawLines(const std::vector<glm::vec2>& points, const glm::vec4& color, float thickness) {
+void Renderer2D::DrawLines(std::span<const glm::vec2> points, const glm::vec4& color, float thickness) {
     size_t n = points.size();
     if (n < 2) return;
 
@@ -77,7 +77,7 @@ void Renderer2D::DrawLines(const std::vector<glm::vec2>& points, const glm::vec4
     }
 }
 
-void Renderer2D::DrawPoints(const std::vector<glm::vec2>& points, const glm::vec4& color, float size) {
+void Renderer2D::DrawPoints(std::span<const glm::vec2> points, const glm::vec4& color, float size) {
     float half = size / 2.0f;
 
     for (auto& p : points) {
@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include <span>
 #include <glm/glm.hpp>
 #include <glad/glad.h>
 #include "../GLShaderManager.hpp"
@@ -16,9 +17,15 @@ public:
     static void Init(int width, int height);
     static void Delete();
 
-    static void DrawPolygon(const std::vector<glm::vec2>& vertices, const glm::vec4& color);
-    static void DrawLines(const std::vector<glm::vec2>& points, const glm::vec4& color, float thickness = 1.0f);
-    static void DrawPoints(const std::vector<glm::vec2>& points, const glm::vec4& color, float size = 1.0f);
+    // Convex polygons (fan triangulated)
+    static void DrawPolygon(std::span<const glm::vec2> vertices, const glm::vec4& color);
+    static void DrawLines(std::span<const glm::vec2> points, const glm::vec4& color, float thickness = 1.0f);
+    static void DrawPoints(std::span<const glm::vec2> points, const glm::vec4& color, float size = 1.0f);
+
+    // Brace-list friendly overloads
+    static void DrawPolygon(const std::vector<glm::vec2>& vertices, const glm::vec4& color) { DrawPolygon(std::span<const glm::vec2>(vertices), color); }
+    static void DrawLines(const std::vector<glm::vec2>& points, const glm::vec4& color, float thickness = 1.0f) { DrawLines(std::span<const glm::vec2>(points), color, thickness); }
+    static void DrawPoints(const std::vector<glm::vec2>& points, const glm::vec4& color, float size = 1.0f) { DrawPoints(std::span<const glm::vec2>(points), color, size); }
 
     static void Render();
 
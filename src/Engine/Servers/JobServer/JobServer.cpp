@@ -0,0 +1,113 @@
+#include "JobServer.hpp"
+#include <cstdlib>
+#include <algorithm>
+
+void JobServer::Init()
+{
+    std::lock_guard<std::mutex> submit(Submit);
+    Start();
+}
+
+void JobServer::Start()
+{
+    if (Started) return;
+    Started = true;
+    Quit = false;
+
+    unsigned count = WorkerCount;
+    if (count == 0) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        count = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    Workers.reserve(count);
+    for (unsigned i = 0; i < count; i++) Workers.emplace_back(WorkerLoop, Generation);
+
+    // Workers have to be joined before the static vector is destroyed
+    static bool registered = false;
+    if (!registered) {
+        registered = true;
+        std::atexit(Shutdown);
+    }
+}
+
+void JobServer::Shutdown()
+{
+    std::lock_guard<std::mutex> submit(Submit);
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Quit = true;
+    }
+    Wake.notify_all();
+    for (std::thread& worker : Workers) worker.join();
+    Workers.clear();
+    Started = false;
+}
+
+void JobServer::ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn)
+{
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    // Not worth waking anyone, or already inside a job (the pool is busy with it)
+    if (count <= grain || InJob) {
+        fn(0, count);
+        return;
+    }
+
+    // One job at a time: other threads (e.g. worlds stepped side by side) wait for this one
+    std::lock_guard<std::mutex> submit(Submit);
+    Start();
+
+    if (Workers.empty()) {
+        InJob = true;   // nested calls run inline instead of waiting on Submit
+        fn(0, count);
+        InJob = false;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Job = &fn;
+        JobCount = count;
+        JobGrain = grain;
+        NextChunk = 0;
+        Busy = Workers.size();
+        Generation++;
+    }
+    Wake.notify_all();
+
+    RunChunks();
+
+    std::unique_lock<std::mutex> lock(Mutex);
+    Done.wait(lock, [] { return Busy == 0; });
+    Job = nullptr;
+}
+
+void JobServer::RunChunks()
+{
+    InJob = true;
+    for (;;) {
+        size_t begin = NextChunk.fetch_add(JobGrain);
+        if (begin >= JobCount) break;
+        (*Job)(begin, std::min(begin + JobGrain, JobCount));
+    }
+    InJob = false;
+}
+
+void JobServer::WorkerLoop(uint64_t seen)
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    for (;;) {
+        Wake.wait(lock, [&] { return Quit || Generation != seen; });
+        if (Quit) return;
+        seen = Generation;
+
+        lock.unlock();
+        RunChunks();
+        lock.lock();
+
+        if (--Busy == 0) Done.notify_one();
+    }
+}
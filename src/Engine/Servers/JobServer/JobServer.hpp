@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <cstdint>
+
+// SERVER
+// Small persistent worker pool. The calling thread takes part in every job.
+// A ParallelFor issued from inside a job runs inline on that thread (e.g. a world's
+// fluid pass while the batch runner steps worlds as jobs). Calls from several outside threads
+// are safe: they take turns, each one owning the whole pool while its job runs.
+class JobServer {
+public:
+    inline static unsigned WorkerCount = 0;     // 0 = one per hardware thread, minus the caller
+
+    static void Init();
+    static void Shutdown();
+
+    // Runs fn(begin, end) over [0, count) in chunks of `grain` and returns when every chunk is done
+    static void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+private:
+    static void Start();
+    static void WorkerLoop(uint64_t seen);
+    static void RunChunks();
+
+    inline static std::vector<std::thread> Workers;
+    inline static std::mutex Submit;            // held by the outside caller for a whole job, and by Init / Shutdown
+    inline static std::mutex Mutex;
+    inline static std::condition_variable Wake;
+    inline static std::condition_variable Done;
+    inline static bool Started = false;
+    inline static bool Quit = false;
+
+    // Current job
+    inline static const std::function<void(size_t, size_t)>* Job = nullptr;
+    inline static size_t JobCount = 0;
+    inline static size_t JobGrain = 1;
+    inline static std::atomic<size_t> NextChunk = 0;
+    inline static size_t Busy = 0;              // workers still running the current job
+    inline static uint64_t Generation = 0;      // bumped for every job
+    inline static thread_local bool InJob = false;
+};
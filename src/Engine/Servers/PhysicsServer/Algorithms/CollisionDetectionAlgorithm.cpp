@@ -1,17 +1,37 @@
 #include "CollisionDetectionAlgorithm.hpp"
 
+// Same even-odd test as Collision2D::hasPoint, on vertices already in world space
+static bool PolygonHasPoint(std::span<const glm::vec2> polygon, glm::vec2 point) {
+    bool inside = false;
+    int n = polygon.size();
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        if (((polygon[i].y > point.y) != (polygon[j].y > point.y)) &&
+            (point.x < (polygon[j].x - polygon[i].x) * (point.y - polygon[i].y) / 
+                      (polygon[j].y - polygon[i].y) + polygon[i].x)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+// Shapes are shared, the size of this instance comes from its transform (circles scale by the larger axis)
+static float ScaledRadius(const Collision2D* obj, const Circle2D* circle) {
+    return circle->radius * std::max(std::abs(obj->transform->scale.x), std::abs(obj->transform->scale.y));
+}
+
 // --------------------- Circle Circle Collision Detection --------------------
-Collision2DInfos CDA::CCCD(Collision2D* A, Collision2D* B) {
-    Collision2DInfos info;
+CollisionResult2D CDA::CCCD(Collision2D* A, Collision2D* B, FrameArena& arena) {
+    CollisionResult2D info;
 
-    Circle2D* circleA = static_cast<Circle2D*>(A->shape);
-    Circle2D* circleB = static_cast<Circle2D*>(B->shape);
+    const Circle2D* circleA = static_cast<const Circle2D*>(A->shape);
+    const Circle2D* circleB = static_cast<const Circle2D*>(B->shape);
     if (!circleA || !circleB) return info;
 
     glm::vec2 delta = B->transform->position - A->transform->position;
     float distSq = glm::dot(delta, delta);
 
-    float totalRadius = circleA->radius + circleB->radius;
+    const float radiusA = ScaledRadius(A, circleA);
+    float totalRadius = radiusA + ScaledRadius(B, circleB);
     float totalRadiusSq = totalRadius * totalRadius;
 
     if (distSq > totalRadiusSq) return info; // No collision
@@ -27,24 +47,24 @@ Collision2DInfos CDA::CCCD(Collision2D* A, Collision2D* B) {
 
         float penetration = totalRadius - dist;
 
-        info.MTV[B] = -normal * penetration;
+        info.MTV = -normal * penetration;
 
         // Contact point halfway between overlap
-        glm::vec2 contact = A->transform->position + normal * (circleA->radius - penetration * 0.5f);
-        info.ContactPoints[B].push_back(contact);
+        info.ContactPoints = arena.Allocate<glm::vec2>(1);
+        info.ContactPoints[0] = A->transform->position + normal * (radiusA - penetration * 0.5f);
     }
 
     return info;
 }
 
 // --------------------- Circle Polygon Collision Detection -------------------
-Collision2DInfos CDA::CPCD(Collision2D* circleObj, Collision2D* polyObj, Collision2D* ReferenceObj) {
-    Collision2DInfos info;
+CollisionResult2D CDA::CPCD(Collision2D* circleObj, Collision2D* polyObj, Collision2D* ReferenceObj, FrameArena& arena) {
+    CollisionResult2D info;
 
-    Circle2D* circle = static_cast<Circle2D*>(circleObj->shape);
+    const Circle2D* circle = static_cast<const Circle2D*>(circleObj->shape);
     if (!circle) return info;
 
-    const auto& verts = polyObj->getVertices();
+    std::span<const glm::vec2> verts = polyObj->getVertices(arena);
     if (verts.size() < 3) return info;
 
     glm::vec2 circleCenter = circleObj->transform->position;
@@ -78,9 +98,9 @@ Collision2DInfos CDA::CPCD(Collision2D* circleObj, Collision2D* polyObj, Collisi
         }
     }
 
-    bool inside = polyObj->hasPoint(circleCenter);
+    bool inside = PolygonHasPoint(verts, circleCenter);
 
-    float radius = circle->radius;
+    float radius = ScaledRadius(circleObj, circle);
     if (inside || minDistSq <= radius * radius) {
         info.isColliding = true;
 
@@ -90,10 +110,10 @@ Collision2DInfos CDA::CPCD(Collision2D* circleObj, Collision2D* polyObj, Collisi
             float minDist = std::sqrt(minDistSq);
             float penetration = inside ? radius + minDist : radius - minDist;
 
-            info.MTV[ReferenceObj] = normal * penetration * ((ReferenceObj != circleObj) ? 1.0f : -1.0f);
+            info.MTV = normal * penetration * ((ReferenceObj != circleObj) ? 1.0f : -1.0f);
 
-            glm::vec2 contact = circleCenter - normal * radius;
-            info.ContactPoints[ReferenceObj].push_back(contact);
+            info.ContactPoints = arena.Allocate<glm::vec2>(1);
+            info.ContactPoints[0] = circleCenter - normal * radius;
         }
     }
 
@@ -147,17 +167,17 @@ static bool EdgeIntersection(const Edge2D& e1, const Edge2D& e2, glm::vec2& cont
     return false;
 }
 
-Collision2DInfos CDA::PPCD(Collision2D* A, Collision2D* B) {
-    Collision2DInfos info;
+CollisionResult2D CDA::PPCD(Collision2D* A, Collision2D* B, FrameArena& arena) {
+    CollisionResult2D info;
 
-    const auto& vertsA = A->getVertices();
-    const auto& vertsB = B->getVertices();
+    std::span<const glm::vec2> vertsA = A->getVertices(arena);
+    std::span<const glm::vec2> vertsB = B->getVertices(arena);
     if (vertsA.size() < 3 || vertsB.size() < 3) return info;
 
     float minOverlap = std::numeric_limits<float>::max();
     glm::vec2 bestAxis(0.0f);
 
-    auto project_on_axis = [](const std::vector<glm::vec2>& verts, const glm::vec2& axis) -> std::pair<float, float> {
+    auto project_on_axis = [](std::span<const glm::vec2> verts, const glm::vec2& axis) -> std::pair<float, float> {
         float minVal = glm::dot(axis, verts[0]);
         float maxVal = minVal;
         for (size_t i = 1; i < verts.size(); ++i) {
@@ -222,75 +242,76 @@ Collision2DInfos CDA::PPCD(Collision2D* A, Collision2D* B) {
         glm::vec2 centerB = B->getCenter();
 
         if (glm::dot(bestAxis, centerB - centerA) < 0.0f) bestAxis = -bestAxis;
-        info.MTV[B] = -bestAxis * minOverlap;
+        info.MTV = -bestAxis * minOverlap;
 
-        std::vector<glm::vec2> contacts;
+        // Room for the 2 kept contacts plus the one the vertex pass can overshoot by
+        std::span<glm::vec2> contacts = arena.Allocate<glm::vec2>(3);
+        size_t count = 0;
 
         // 1) Fast: vertices inside the other polygon
         for (const auto& v : vertsA) {
-            if (B->hasPoint(v)) {
-                contacts.push_back(v);
-                if (contacts.size() >= 2) break;
+            if (PolygonHasPoint(vertsB, v)) {
+                contacts[count++] = v;
+                if (count >= 2) break;
             }
         }
         for (const auto& v : vertsB) {
-            if (A->hasPoint(v)) {
-                contacts.push_back(v);
-                if (contacts.size() >= 2) break;
+            if (PolygonHasPoint(vertsA, v)) {
+                contacts[count++] = v;
+                if (count >= 2) break;
             }
         }
 
         // 2) Edge intersections if not enough contacts
-        if (contacts.size() < 2) {
-            for (auto& edgeA : A->getEdges()) {
-                for (auto& edgeB : B->getEdges()) {
+        if (count < 2) {
+            std::span<const Edge2D> edgesA = A->getEdges(arena);
+            std::span<const Edge2D> edgesB = B->getEdges(arena);
+            for (auto& edgeA : edgesA) {
+                for (auto& edgeB : edgesB) {
                     glm::vec2 c;
                     if (EdgeIntersection(edgeA, edgeB, c)) {
                         bool duplicate = false;
-                        for (const auto& existing : contacts) {
-                            if (glm::length2(c - existing) < EPS * EPS) {
+                        for (size_t k = 0; k < count; k++) {
+                            if (glm::length2(c - contacts[k]) < EPS * EPS) {
                                 duplicate = true;
                                 break;
                             }
                         }
                         if (!duplicate) {
-                            contacts.push_back(c);
-                            if (contacts.size() >= 2) break;
+                            contacts[count++] = c;
+                            if (count >= 2) break;
                         }
                     }
                 }
-                if (contacts.size() >= 2) break;
+                if (count >= 2) break;
             }
         }
 
         // 3) Final fallback: use midpoint of centers
-        if (contacts.empty()) {
-            contacts.push_back((centerA + centerB) * 0.5f);
+        if (count == 0) {
+            contacts[count++] = (centerA + centerB) * 0.5f;
         }
 
         // Store only up to 2 contacts
-        for (const auto& c : contacts) {
-            info.ContactPoints[B].push_back(c);
-            if (info.ContactPoints[B].size() >= 2) break;
-        }
+        info.ContactPoints = contacts.first(std::min<size_t>(count, 2));
     }
 
     return info;
 }
 
 // ----------------------- Global Collision Detection -------------------------
-Collision2DInfos CDA::Detect(Collision2D* A, Collision2D* B) {
-    const auto& vertsA = A->getVertices();
-    const auto& vertsB = B->getVertices();
-    if (vertsA.empty() || vertsB.empty()) return Collision2DInfos();
-
-    Circle2D* circleA = dynamic_cast<Circle2D*>(A->shape);
-    Circle2D* circleB = dynamic_cast<Circle2D*>(B->shape);
-
-    if (circleA && circleB) return CCCD(A, B);
-    if (circleA && vertsB.size() >= 3) return CPCD(A, B, B);
-    if (circleB && vertsA.size() >= 3) return CPCD(B, A, B);
-    return PPCD(A, B);
+CollisionResult2D CDA::Detect(Collision2D* A, Collision2D* B, FrameArena& arena) {
+    const auto& vertsA = A->shape->vertices;
+    const auto& vertsB = B->shape->vertices;
+    if (vertsA.empty() || vertsB.empty()) return CollisionResult2D();
+
+    const Circle2D* circleA = dynamic_cast<const Circle2D*>(A->shape);
+    const Circle2D* circleB = dynamic_cast<const Circle2D*>(B->shape);
+
+    if (circleA && circleB) return CCCD(A, B, arena);
+    if (circleA && vertsB.size() >= 3) return CPCD(A, B, B, arena);
+    if (circleB && vertsA.size() >= 3) return CPCD(B, A, B, arena);
+    return PPCD(A, B, arena);
 }
 
 
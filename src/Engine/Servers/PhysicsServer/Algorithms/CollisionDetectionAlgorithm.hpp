@@ -1,10 +1,18 @@
 #pragma once
 #include "Engine/Object/2D/Collision2D.hpp"
 
+// Narrow phase result for one pair (A, B), contacts live in the frame arena
+struct CollisionResult2D {
+    bool isColliding = false;
+    bool isPhysicsColliding = false;
+    glm::vec2 MTV = glm::vec2(0.0f);        // pushes A out of B
+    std::span<glm::vec2> ContactPoints;
+};
+
 namespace CDA
 {
-    Collision2DInfos Detect(Collision2D* A, Collision2D* B);
-    Collision2DInfos CCCD(Collision2D* A, Collision2D* B);
-    Collision2DInfos CPCD(Collision2D* circle, Collision2D* poly, Collision2D* ref);
-    Collision2DInfos PPCD(Collision2D* A, Collision2D* B);
+    CollisionResult2D Detect(Collision2D* A, Collision2D* B, FrameArena& arena);
+    CollisionResult2D CCCD(Collision2D* A, Collision2D* B, FrameArena& arena);
+    CollisionResult2D CPCD(Collision2D* circle, Collision2D* poly, Collision2D* ref, FrameArena& arena);
+    CollisionResult2D PPCD(Collision2D* A, Collision2D* B, FrameArena& arena);
 }
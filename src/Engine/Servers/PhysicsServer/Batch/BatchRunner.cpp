@@ -0,0 +1,100 @@
+#include "BatchRunner.hpp"
+#include <Engine/Servers/PhysicsServer/PhysicsWorld.hpp>
+#include <Engine/Servers/JobServer/JobServer.hpp>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <algorithm>
+
+namespace Batch {
+
+using Clock = std::chrono::steady_clock;
+
+static double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// ------------------- Worker -------------------
+// Only touches its own world: fluid / gravity passes inside fall back to inline ParallelFor
+static void StepWorld(PhysicsWorld& world, const WorldConfig& config, WorldResult& result, const Options& options)
+{
+    const Clock::time_point start = Clock::now();
+    const int steps = std::max(config.steps, 0);
+    double iterations = 0.0;
+
+    for (int s = 0; s < steps; s++) {
+        world.Update(config.delta);
+        result.maxPenetration = std::max(result.maxPenetration, world.Stats.maxPenetration);
+        iterations += world.Stats.iterations;
+    }
+
+    result.seconds = SecondsSince(start);
+    result.steps = steps;
+    result.meanIterations = steps ? iterations / steps : 0.0;
+    result.hash = world.Determinism.Hash();
+
+    const RigidBodyStore& store = world.RigidBodies.Store;
+    if (options.captureBodies) result.bodies.resize(store.Size());
+    for (size_t i = 0; i < store.Size(); i++) {
+        const bool sleeping = store.HasFlag(uint32_t(i), RigidBodyStore::Sleeping);
+        result.sleeping += sleeping;
+        if (!options.captureBodies) continue;
+
+        BodyState& body = result.bodies[i];
+        body.position = {store.positionX[i], store.positionY[i]};
+        body.rotation = orientation_to_degrees({store.rotationCos[i], store.rotationSin[i]});
+        body.linearVelocity = {store.velocityX[i], store.velocityY[i]};
+        body.angularVelocity = store.angularVelocity[i];
+        body.sleeping = sleeping;
+    }
+
+    if (options.collect) options.collect(world, config, result);
+}
+
+// -------------------- Waves -------------------
+RunStats Run(std::span<const WorldConfig> configs, std::vector<WorldResult>& results, const Options& options)
+{
+    RunStats stats;
+    results.assign(configs.size(), WorldResult());
+    if (configs.empty()) return stats;
+
+    JobServer::Init();
+    const size_t wave = options.inFlight ? options.inFlight : 4 * size_t(std::max(std::thread::hardware_concurrency(), 1u));
+    const Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<PhysicsWorld>> worlds;
+    worlds.reserve(std::min(wave, configs.size()));
+
+    for (size_t first = 0; first < configs.size(); first += wave) {
+        const size_t count = std::min(wave, configs.size() - first);
+
+        // Worlds share nothing but the locked pools: build them in parallel too
+        worlds.resize(count);
+        JobServer::ParallelFor(count, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const WorldConfig& config = configs[first + i];
+                worlds[i] = std::make_unique<PhysicsWorld>(config.bounds);
+                if (config.setup) config.setup(*worlds[i], config);
+            }
+        });
+
+        const Clock::time_point stepStart = Clock::now();
+        JobServer::ParallelFor(count, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                StepWorld(*worlds[i], configs[first + i], results[first + i], options);
+        });
+        stats.stepSeconds += SecondsSince(stepStart);
+
+        JobServer::ParallelFor(count, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) worlds[i].reset();
+        });
+        worlds.clear();
+    }
+
+    stats.worlds = configs.size();
+    for (const WorldResult& result : results) stats.worldSteps += uint64_t(result.steps);
+    stats.seconds = SecondsSince(start);
+    stats.worldStepsPerSecond = stats.seconds > 0.0 ? double(stats.worldSteps) / stats.seconds : 0.0;
+    return stats;
+}
+
+}
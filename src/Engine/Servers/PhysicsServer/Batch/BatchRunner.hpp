@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <span>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <Math/Math.hpp>
+
+class PhysicsWorld;
+
+/*
+Headless batch stepping of independent worlds (tuning sweeps, rollouts):
+    worlds are built in waves on the JobServer, one world per job (the process-wide pools are locked)
+    each wave is stepped on the JobServer, one world per job, no renderer involved
+    metrics and final body states are collected on the worker, then the wave is destroyed the same way
+*/
+
+namespace Batch {
+    struct WorldConfig {
+        AABB bounds = AABB(640.0f, 360.0f, 640.0f, 360.0f);
+        int steps = 600;
+        float delta = 1.0f / 60.0f;
+        uint64_t seed = 0;      // free for setup (scene randomization)
+
+        // Spawns the scene and sets the world settings (gravity, solver mode, ...), on a worker:
+        // called concurrently for different worlds, so it must only touch its own world and config
+        std::function<void(PhysicsWorld& world, const WorldConfig& config)> setup;
+    };
+
+    struct BodyState {
+        glm::vec2 position = {0, 0};
+        float rotation = 0.0f;          // degrees
+        glm::vec2 linearVelocity = {0, 0};
+        float angularVelocity = 0.0f;
+        bool sleeping = false;
+    };
+
+    struct WorldResult {
+        uint64_t hash = 0;              // DeterminismSystem::Hash() after the last step
+        int steps = 0;
+        double seconds = 0.0;           // time spent stepping this world
+        float maxPenetration = 0.0f;    // worst over every step
+        double meanIterations = 0.0;    // solver iterations (XPBD: substeps) per step
+        size_t sleeping = 0;
+        std::vector<BodyState> bodies;  // final state in RigidBodyStore order (empty unless captured)
+    };
+
+    struct Options {
+        size_t inFlight = 0;            // worlds alive at once, 0 = 4 per hardware thread
+        bool captureBodies = true;
+        // Extra metrics, run on the worker right after the world's last step
+        std::function<void(const PhysicsWorld& world, const WorldConfig& config, WorldResult& result)> collect;
+    };
+
+    struct RunStats {
+        size_t worlds = 0;
+        uint64_t worldSteps = 0;
+        double seconds = 0.0;           // wall time, building and destroying included
+        double stepSeconds = 0.0;       // wall time of the parallel stepping only
+        double worldStepsPerSecond = 0.0;
+    };
+
+    // Steps every configuration to completion, results[i] belongs to configs[i].
+    // Must be called from outside a JobServer job (the worlds are the jobs).
+    RunStats Run(std::span<const WorldConfig> configs, std::vector<WorldResult>& results, const Options& options = {});
+}
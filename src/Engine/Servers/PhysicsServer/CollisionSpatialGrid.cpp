@@ -1,91 +1,166 @@
 #include "CollisionSpatialGrid.hpp"
 #include <Engine/Renderer/2D/Renderer2D.hpp>
 #include <algorithm>
-#include <functional>
-
-void CollisionSpatialGrid::Update() {
-    Grid.clear();
-    const float cellSize = Board.hw * 2.0f / float(CellCount);
-    
-    for (Collision2D* obj : Objects) {
-        const AABB& aabb = obj->getBounds();
-        int minX = static_cast<int>((aabb.x - aabb.hw - Board.x + Board.hw) / cellSize);
-        int maxX = static_cast<int>((aabb.x + aabb.hw - Board.x + Board.hw) / cellSize);
-        int minY = static_cast<int>((aabb.y - aabb.hh - Board.y + Board.hh) / cellSize);
-        int maxY = static_cast<int>((aabb.y + aabb.hh - Board.y + Board.hh) / cellSize);
+#include <memory>
+
+static int CellX(const AABB& board, float cellSize, float x) {
+    return static_cast<int>((x - board.min.x) / cellSize);
+}
+
+static int CellY(const AABB& board, float cellSize, float y) {
+    return static_cast<int>((y - board.min.y) / cellSize);
+}
+
+static uint64_t CellKey(int x, int y) {
+    return (static_cast<uint64_t>(x) << 32) | static_cast<uint32_t>(y);
+}
+
+void CollisionSpatialGrid::Update(FrameArena& arena) {
+    const float cellSize = Board.getSize().x / float(CellCount);
+
+    // Every world vertex in one batch, then the bounds of each object and the exact entry count
+    std::span<const Transform2D*> transforms = arena.Allocate<const Transform2D*>(Objects.size());
+    std::span<std::span<const glm::vec2>> shapes = arena.Allocate<std::span<const glm::vec2>>(Objects.size());
+    size_t vertexCount = 0;
+    for (size_t i = 0; i < Objects.size(); i++) {
+        transforms[i] = Objects[i]->transform;
+        std::construct_at(&shapes[i], Objects[i]->shape->vertices);
+        vertexCount += shapes[i].size();
+    }
+    std::span<glm::vec2> vertices = arena.Allocate<glm::vec2>(vertexCount);
+    Transform2D::ApplyBatch(transforms, shapes, vertices);
+
+    Bounds = arena.Allocate<AABB>(Objects.size());
+    size_t count = 0;
+    for (size_t i = 0, first = 0; i < Objects.size(); first += shapes[i].size(), i++) {
+        glm::vec2 min(0.0f), max(0.0f);
+        if (!shapes[i].empty()) {
+            min = max = vertices[first];
+            for (glm::vec2 v : vertices.subspan(first, shapes[i].size())) {
+                min = glm::min(min, v);
+                max = glm::max(max, v);
+            }
+        }
+        const AABB& aabb = *std::construct_at(&Bounds[i], AABB::FromMinMax(min, max));
+        int minX = CellX(Board, cellSize, aabb.min.x);
+        int maxX = CellX(Board, cellSize, aabb.max.x);
+        int minY = CellY(Board, cellSize, aabb.min.y);
+        int maxY = CellY(Board, cellSize, aabb.max.y);
+        count += size_t(maxX - minX + 1) * size_t(maxY - minY + 1);
+    }
+
+    Cells = arena.Allocate<Entry>(count);
+    count = 0;
+    for (size_t i = 0; i < Objects.size(); i++) {
+        const AABB& aabb = Bounds[i];
+        int minX = CellX(Board, cellSize, aabb.min.x);
+        int maxX = CellX(Board, cellSize, aabb.max.x);
+        int minY = CellY(Board, cellSize, aabb.min.y);
+        int maxY = CellY(Board, cellSize, aabb.max.y);
         
         for (int x = minX; x <= maxX; ++x) {
             for (int y = minY; y <= maxY; ++y) {
-                uint64_t cellKey = (static_cast<uint64_t>(x) << 32) | static_cast<uint32_t>(y);
-                Grid[cellKey].push_back(obj);
+                Cells[count++] = {CellKey(x, y), static_cast<uint32_t>(i)};
             }
         }
     }
+
+    // Objects keep their Objects order inside a cell
+    std::sort(Cells.begin(), Cells.end(), [](const Entry& a, const Entry& b) {
+        return a.cell != b.cell ? a.cell < b.cell : a.object < b.object;
+    });
 }
 
 void CollisionSpatialGrid::Render() {
-    const float cellSize = Board.hw * 2.0f / float(CellCount);
+    const float cellSize = Board.getSize().x / float(CellCount);
     for (int i = 0; i <= CellCount; i++) {
-        float x = Board.x - Board.hw + i * cellSize;
-        float y = Board.y - Board.hh + i * cellSize;
+        float x = Board.min.x + i * cellSize;
+        float y = Board.min.y + i * cellSize;
 
-        Renderer2D::DrawLines({{x, Board.y - Board.hh}, {x, Board.y + Board.hh}}, {1, 1, 1, 1});
-        Renderer2D::DrawLines({{Board.x - Board.hw, y}, {Board.x + Board.hw, y}}, {1, 1, 1, 1});
+        Renderer2D::DrawLines({{x, Board.min.y}, {x, Board.max.y}}, {1, 1, 1, 1});
+        Renderer2D::DrawLines({{Board.min.x, y}, {Board.max.x, y}}, {1, 1, 1, 1});
     }
 }
 
 
-struct PairHash {
-    size_t operator()(const std::pair<Collision2D*, Collision2D*>& p) const {
-        // Always hash in canonical order
-        Collision2D* first = std::min(p.first, p.second);
-        Collision2D* second = std::max(p.first, p.second);
-        return std::hash<Collision2D*>()(first) ^ (std::hash<Collision2D*>()(second) << 1);
+// A pair can share several cells: it is only reported by the cell holding the min corner
+// of the two bounds' overlap, which both objects always cover
+static bool OwnsPair(const AABB& board, float cellSize, uint64_t key, const AABB& a, const AABB& b) {
+    int x = CellX(board, cellSize, std::max(a.min.x, b.min.x));
+    int y = CellY(board, cellSize, std::max(a.min.y, b.min.y));
+    return CellKey(x, y) == key;
+}
+
+// Pair rules: a rigid body meets every physics body, a static body only rigid bodies,
+// then the layers (CollisionFilter2D) of both colliders have to agree
+
+std::span<std::pair<Collision2D*, Collision2D*>> CollisionSpatialGrid::CollectPhyisicsPair(FrameArena& arena) {
+    const float cellSize = Board.getSize().x / float(CellCount);
+
+    // Tags and layers copied out once, the pair loop never touches the colliders.
+    // A static rigid body pairs like a static body: the moving side comes first and owns the
+    // pair's infos (the solvers skip static owners), two static ones are never paired.
+    std::span<BodyKind2D> kinds = arena.Allocate<BodyKind2D>(Objects.size());
+    std::span<CollisionFilter2D> filters = arena.Allocate<CollisionFilter2D>(Objects.size());
+    std::span<uint32_t> slots = arena.Allocate<uint32_t>(Objects.size());    // store index of rigid bodies
+    for (size_t i = 0; i < Objects.size(); i++) {
+        const Collision2D* col = Objects[i];
+        const RigidBody2D* rigid = RigidBody2D::FromCollision(col);
+        kinds[i] = (rigid && rigid->IsStatic()) ? BodyKind2D::Static : col->bodyKind;
+        std::construct_at(&filters[i], col->filter);
+        slots[i] = rigid ? rigid->getStoreIndex() : 0;
     }
-};
 
-struct PairEqual {
-    bool operator()(const std::pair<Collision2D*, Collision2D*>& a, const std::pair<Collision2D*, Collision2D*>& b) const {
-        auto canonA = std::make_pair(std::min(a.first, a.second), std::max(a.first, a.second));
-        auto canonB = std::make_pair(std::min(b.first, b.second), std::max(b.first, b.second));
-        return canonA == canonB;
+    // Upper bound: every in-cell pair
+    size_t capacity = 0, longest = 0;
+    for (size_t begin = 0, end = 0; begin < Cells.size(); begin = end) {
+        for (end = begin; end < Cells.size() && Cells[end].cell == Cells[begin].cell; end++) {}
+        capacity += (end - begin) * (end - begin - 1) / 2;
+        longest = std::max(longest, end - begin);
     }
-};
+    std::span<std::pair<Collision2D*, Collision2D*>> pairs = arena.Allocate<std::pair<Collision2D*, Collision2D*>>(capacity);
+    size_t count = 0;
+    uint64_t distance = 0, rigidPairs = 0;
 
-std::vector<std::pair<Collision2D*, Collision2D*>> CollisionSpatialGrid::CollectPhyisicsPair() {
-    std::unordered_set<std::pair<Collision2D*, Collision2D*>, PairHash, PairEqual> uniquePairs;
-    
-    for (auto& cell : Grid) {
-        auto& objectsInCell = cell.second;
-        
-        for (size_t i = 0; i < objectsInCell.size(); ++i) {
-            Collision2D* a = objectsInCell[i];
-            if(dynamic_cast<RigidBody2D*>(a->PHYSICS_PARENT))
-                for (size_t j = i + 1; j < objectsInCell.size(); ++j) {
-                    if (i == j) continue;
-                    Collision2D* b = objectsInCell[j];
-                    if(!dynamic_cast<PhysicsBody2D*>(b->PHYSICS_PARENT)) continue;
-                    if (a == b) continue;
-                    
-                    if (a->getBounds().intersects(b->getBounds())) {
-                        uniquePairs.emplace(a, b);
-                    }
-                }
-            else if(dynamic_cast<PhysicsBody2D*>(a->PHYSICS_PARENT))
-                for (size_t j = i + 1; j < objectsInCell.size(); ++j) {
-                    if (i == j) continue;
-                    Collision2D* b = objectsInCell[j];
-                    if(!dynamic_cast<RigidBody2D*>(b->PHYSICS_PARENT)) continue;
-                    if (a == b) continue;
-                    
-                    if (a->getBounds().intersects(b->getBounds())) {
-                        uniquePairs.emplace(b, a);
-                    }
+    // Each cell's bounds are copied into SoA lanes and tested one against the rest, 4 at a time
+    AABBBatch batch(arena.Allocate<float>(4 * AABBBatch::Padded(longest)), longest);
+
+    for (size_t begin = 0, end = 0; begin < Cells.size(); begin = end) {
+        const uint64_t cell = Cells[begin].cell;
+        for (end = begin; end < Cells.size() && Cells[end].cell == cell; end++) {}
+        if (end - begin < 2) continue;
+
+        for (size_t i = begin; i < end; i++) batch.Set(i - begin, Bounds[Cells[i].object]);
+        batch.Resize(end - begin);
+
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t objectA = Cells[i].object;
+            const BodyKind2D kindA = kinds[objectA];
+            if (kindA == BodyKind2D::None) continue;
+            const CollisionFilter2D& filterA = filters[objectA];
+            const AABB& boundsA = Bounds[objectA];
+
+            batch.ForEachOverlap(boundsA, i - begin + 1, [&](size_t j) {
+                const uint32_t objectB = Cells[begin + j].object;
+                const BodyKind2D kindB = kinds[objectB];
+                if (kindA == BodyKind2D::Rigid ? kindB == BodyKind2D::None : kindB != BodyKind2D::Rigid) return;
+                if (objectA == objectB || !CollisionFilter2D::ShouldCollide(filterA, filters[objectB])) return;
+                if (!OwnsPair(Board, cellSize, cell, boundsA, Bounds[objectB])) return;
+                Collision2D* a = Objects[objectA];
+                Collision2D* b = Objects[objectB];
+
+                if (kindA == BodyKind2D::Rigid && kindB == BodyKind2D::Rigid) {
+                    distance += slots[objectA] > slots[objectB] ? slots[objectA] - slots[objectB] : slots[objectB] - slots[objectA];
+                    rigidPairs++;
                 }
+
+                // Two moving rigid bodies: lower creation id first, whatever their slots in Objects
+                if (kindA == BodyKind2D::Rigid && (kindB != BodyKind2D::Rigid || a->id < b->id)) std::construct_at(&pairs[count++], a, b);
+                else std::construct_at(&pairs[count++], b, a);
+            });
         }
     }
-    
-    return std::vector<std::pair<Collision2D*, Collision2D*>>(uniquePairs.begin(), uniquePairs.end());
-}
-
 
+    PairDistance = rigidPairs ? float(double(distance) / double(rigidPairs)) : 0.0f;
+    return pairs.first(count);
+}
@@ -1,31 +1,68 @@
 #pragma once
 #include <Math/Math.hpp>
+#include <Math/AABBBatch.hpp>
 #include <Engine/Object/2D/Object2D.h>
+#include <Engine/Memory/FrameArena.hpp>
+#include <span>
+#include <algorithm>
 
 class CollisionSpatialGrid {
 public:
     int CellCount = 100;
     AABB Board;
-    std::vector<Collision2D*> Objects;
-    std::unordered_map<uint64_t, std::vector<Collision2D*>> Grid;
+    std::vector<Collision2D*> Objects;      // unordered: removal moves the last object into the hole
+
+    // One entry per (cell, object) overlap, sorted by cell: a cell is a run of entries.
+    // Rebuilt by Update() in the frame arena, with the bounds of every object.
+    struct Entry {
+        uint64_t cell;
+        uint32_t object;    // index in Objects
+    };
+    std::span<Entry> Cells;
+    std::span<AABB> Bounds;     // compact min / max boxes, indexed like Objects
+
+    // Mean RigidBodyStore index distance between the two bodies of the last collected rigid pairs:
+    // how far apart in memory the solver reads are (lower is better, see PhysicsWorld::ReorderSystem)
+    float PairDistance = 0.0f;
 
     CollisionSpatialGrid(const AABB& board = AABB()) : Board(board) {}
     
-    void Update();
+    void Update(FrameArena& arena);
     void Render();
 
-    std::vector<std::pair<Collision2D*, Collision2D*>> CollectPhyisicsPair();
+    // Each touching pair once, rigid body first (lower id first between two); lives in the arena
+    std::span<std::pair<Collision2D*, Collision2D*>> CollectPhyisicsPair(FrameArena& arena);
     
+    // Objects in memory (address) order, false if they already were.
+    // Invalidates Cells / Bounds until the next Update()
+    bool SortByAddress() {
+        if (std::is_sorted(Objects.begin(), Objects.end(), std::less<Collision2D*>())) return false;
+        std::sort(Objects.begin(), Objects.end(), std::less<Collision2D*>());
+        for (uint32_t k = 0; k < Objects.size(); k++) Objects[k]->gridIndex = k;
+        Cells = {};
+        Bounds = {};
+        return true;
+    }
+
     void Clear() {
         Objects.clear();
-        Grid.clear();
+        Cells = {};
+        Bounds = {};
     }
     
     void AddObject(Collision2D* obj) {
+        obj->gridIndex = static_cast<uint32_t>(Objects.size());
         Objects.push_back(obj);
     }
     
+    // O(1) swap-and-pop through the slot stored in the collider
     void RemoveObject(Collision2D* obj) {
-        Objects.erase(std::remove(Objects.begin(), Objects.end(), obj), Objects.end());
+        const uint32_t index = obj->gridIndex;
+        if (index >= Objects.size() || Objects[index] != obj) return;
+        Collision2D* last = Objects.back();
+        Objects[index] = last;
+        last->gridIndex = index;
+        Objects.pop_back();
+        obj->gridIndex = UINT32_MAX;
     }
 };
\ No newline at end of file
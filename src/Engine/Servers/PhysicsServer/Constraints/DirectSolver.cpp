@@ -0,0 +1,462 @@
+#include <Engine/Servers/PhysicsServer/PhysicsWorld.hpp>
+
+/*
+Direct solver for joints flagged `direct` (chains, ropes, bridges, any tree of bodies).
+
+Each step it solves the joint system exactly at the velocity level:
+    (J M⁻¹ Jᵀ) λ = -(J u + bias)
+with a sparse block LDLᵀ factorization. Joints are eliminated in DFS post-order
+of the body/joint tree, so every joint's remaining neighbours all hang off a single
+(parent) body: no fill-in, O(n) per chain. The factorization happens once per step,
+each solver iteration only runs the forward/back substitution.
+
+Groups with loops are not trees, they fall back to block Gauss-Seidel.
+*/
+
+namespace {
+
+struct Block3 {
+    double m[3][3] = {};
+};
+
+struct Vec3 {
+    double v[3] = {};
+};
+
+Block3 Multiply(const Block3& a, const Block3& b) {
+    Block3 r;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j];
+    return r;
+}
+
+Block3 Transpose(const Block3& a) {
+    Block3 r;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            r.m[i][j] = a.m[j][i];
+    return r;
+}
+
+Vec3 Multiply(const Block3& a, const Vec3& x) {
+    Vec3 r;
+    for (int i = 0; i < 3; i++)
+        r.v[i] = a.m[i][0] * x.v[0] + a.m[i][1] * x.v[1] + a.m[i][2] * x.v[2];
+    return r;
+}
+
+void Subtract(Block3& a, const Block3& b) {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            a.m[i][j] -= b.m[i][j];
+}
+
+Block3 Inverse(const Block3& a) {
+    const auto& m = a.m;
+    double c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    double c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    double c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    double det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+
+    Block3 r;
+    if (std::abs(det) < 1e-18) return r;
+    double inv = 1.0 / det;
+    r.m[0][0] = c00 * inv;
+    r.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv;
+    r.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv;
+    r.m[1][0] = c01 * inv;
+    r.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv;
+    r.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv;
+    r.m[2][0] = c02 * inv;
+    r.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv;
+    r.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv;
+    return r;
+}
+
+// One joint = one block row of J (1 to 3 scalar rows, padded to 3)
+struct Row {
+    int dim = 0;
+    int node[2] = {-1, -1};         // body nodes for A / B (-1 = world or static)
+    Block3 J[2];                    // Jacobian block per side, rows x (vx, vy, w)
+    Vec3 bias;
+
+    Block3 D, Dinv;                 // (eliminated) diagonal block
+    int parent = -1;                // node all later neighbours hang off (-1 = none)
+    int slot = -1;                  // position of the row in its parent's list
+    int order = -1;                 // elimination position
+    bool tree = true;               // false: part of a loop, Gauss-Seidel fallback
+};
+
+struct Node {
+    RigidBody2D* body = nullptr;
+    double invMass = 0.0, invInertia = 0.0;
+    int first = 0, count = 0;       // slice of NodeRows
+    int blocks = 0;                 // offset into Blocks (count x count)
+};
+
+} // namespace
+
+// Factorization scratch of one world (JointSystem::Direct), reused every step
+struct PhysicsWorld::JointSystem::DirectSolver {
+    std::vector<Row> Rows;
+    std::vector<Node> Nodes;
+    std::vector<int> NodeRows;          // rows attached to each node (CSR)
+    std::vector<int> NodeOfBody;        // store index -> node, only set while the rows are built
+    std::vector<Block3> Blocks;         // off-diagonal A blocks, per node
+    std::vector<int> Order;             // elimination order (tree rows only)
+    std::vector<Vec3> Rhs, Lambda;
+
+    // DFS scratch of Prepare()
+    struct Frame { int node; int via; int next; };
+    std::vector<int> NodeState;         // 0 = unseen, 1 = open, 2 = done
+    std::vector<int> RowSeen;
+    std::vector<Frame> Stack;
+    std::vector<int> GroupRows;
+
+    int SideOf(const Row& row, int node) { return row.node[0] == node ? 0 : 1; }
+
+    int SlotOf(const Node& node, int rowIndex) {
+        for (int s = 0; s < node.count; s++)
+            if (NodeRows[node.first + s] == rowIndex) return s;
+        return -1;
+    }
+
+    Block3& BlockAt(const Node& node, int x, int y) { return Blocks[node.blocks + x * node.count + y]; }
+
+    // J_side M⁻¹ J'_sideᵀ
+    Block3 CouplingBlock(const Block3& Ja, const Block3& Jb, const Node& node) {
+        Block3 r;
+        const double w[3] = {node.invMass, node.invMass, node.invInertia};
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                r.m[i][j] = Ja.m[i][0] * w[0] * Jb.m[j][0] + Ja.m[i][1] * w[1] * Jb.m[j][1] + Ja.m[i][2] * w[2] * Jb.m[j][2];
+        return r;
+    }
+
+    int NodeFor(RigidBody2D* body) {
+        if (!body || body->IsStatic() || body->IsSleeping()) return -1;
+        int& node = NodeOfBody[body->getStoreIndex()];
+        if (node < 0) {
+            node = int(Nodes.size());
+            Node n;
+            n.body = body;
+            n.invMass = body->getInverseMass();
+            n.invInertia = body->getInverseInertia();
+            Nodes.push_back(n);
+        }
+        return node;
+    }
+
+    void SetRow(Block3& J, int row, double vx, double vy, double w) {
+        J.m[row][0] = vx;
+        J.m[row][1] = vy;
+        J.m[row][2] = w;
+    }
+
+    // Linear row along n acting at arms rA / rB
+    void AddLinearRow(Row& row, glm::vec2 n, glm::vec2 rA, glm::vec2 rB, float bias) {
+        SetRow(row.J[0], row.dim, -n.x, -n.y, -cross(rA, n));
+        SetRow(row.J[1], row.dim, n.x, n.y, cross(rB, n));
+        row.bias.v[row.dim++] = bias;
+    }
+
+    void AddAngularRow(Row& row, float bias) {
+        SetRow(row.J[0], row.dim, 0.0, 0.0, -1.0);
+        SetRow(row.J[1], row.dim, 0.0, 0.0, 1.0);
+        row.bias.v[row.dim++] = bias;
+    }
+
+    void AddRow(Row row, const JointLink2D& link) {
+        row.node[0] = NodeFor(link.bodyA);
+        row.node[1] = NodeFor(link.bodyB);
+        if (row.node[0] < 0 && row.node[1] < 0) return;
+        if (row.node[0] == row.node[1]) return;
+        Rows.push_back(row);
+    }
+
+    Vec3 RowVelocity(const Row& row) {
+        Vec3 r;
+        for (int side = 0; side < 2; side++) {
+            if (row.node[side] < 0) continue;
+            RigidBody2D* body = Nodes[row.node[side]].body;
+            glm::vec2 v = body->getLinearVelocity();
+            Vec3 u;
+            u.v[0] = v.x;
+            u.v[1] = v.y;
+            u.v[2] = body->getAngularVelocity();
+            Vec3 Ju = Multiply(row.J[side], u);
+            for (int i = 0; i < 3; i++) r.v[i] += Ju.v[i];
+        }
+        return r;
+    }
+
+    void ApplyRowImpulse(const Row& row, const Vec3& lambda) {
+        for (int side = 0; side < 2; side++) {
+            if (row.node[side] < 0) continue;
+            RigidBody2D* body = Nodes[row.node[side]].body;
+            Vec3 P = Multiply(Transpose(row.J[side]), lambda);
+            body->ApplyImpulse(glm::vec2(float(P.v[0]), float(P.v[1])));
+            body->ApplyAngularImpulse(float(P.v[2]));
+        }
+    }
+
+    Vec3 RowRhs(const Row& row) {
+        Vec3 Ju = RowVelocity(row);
+        Vec3 b;
+        for (int i = 0; i < row.dim; i++) b.v[i] = -(Ju.v[i] + row.bias.v[i]);
+        return b;
+    }
+
+    void Prepare(const JointSystem& joints, size_t bodyCount);
+    void Solve();
+};
+
+// ------------------- Prepare ------------------
+// Builds the rows from the prepared joint caches, orders and factors every tree
+void PhysicsWorld::JointSystem::DirectSolver::Prepare(const JointSystem& joints, size_t bodyCount)
+{
+    Rows.clear();
+    Nodes.clear();
+    Order.clear();
+    // All -1 between steps: grown here, and only the entries used get reset below
+    if (NodeOfBody.size() < bodyCount) NodeOfBody.resize(bodyCount, -1);
+
+    for (const DistanceJoint2D& j : joints.DistanceJoints) {
+        if (!j.direct) continue;
+        Row row;
+        AddLinearRow(row, j.axis, j.rA, j.rB, j.bias);
+        AddRow(row, j);
+    }
+
+    for (const RevoluteJoint2D& j : joints.RevoluteJoints) {
+        if (!j.direct) continue;
+        Row row;
+        AddLinearRow(row, {1.0f, 0.0f}, j.rA, j.rB, j.bias.x);
+        AddLinearRow(row, {0.0f, 1.0f}, j.rA, j.rB, j.bias.y);
+        AddRow(row, j);
+    }
+
+    for (const PrismaticJoint2D& j : joints.PrismaticJoints) {
+        if (!j.direct) continue;
+        Row row;
+        AddLinearRow(row, j.perp, j.armA, j.rB, j.linearBias);
+        AddAngularRow(row, j.angularBias);
+        AddRow(row, j);
+    }
+
+    for (const WeldJoint2D& j : joints.WeldJoints) {
+        if (!j.direct) continue;
+        Row row;
+        AddLinearRow(row, {1.0f, 0.0f}, j.rA, j.rB, j.bias.x);
+        AddLinearRow(row, {0.0f, 1.0f}, j.rA, j.rB, j.bias.y);
+        AddAngularRow(row, j.angularBias);
+        AddRow(row, j);
+    }
+
+    for (const Node& node : Nodes) NodeOfBody[node.body->getStoreIndex()] = -1;
+    if (Rows.empty()) return;
+
+    // Node -> rows (CSR)
+    for (const Row& row : Rows)
+        for (int side = 0; side < 2; side++)
+            if (row.node[side] >= 0) Nodes[row.node[side]].count++;
+
+    int offset = 0, blockOffset = 0;
+    for (Node& node : Nodes) {
+        node.first = offset;
+        node.blocks = blockOffset;
+        offset += node.count;
+        blockOffset += node.count * node.count;
+        node.count = 0;
+    }
+    NodeRows.resize(offset);
+    Blocks.assign(blockOffset, Block3());
+
+    for (int r = 0; r < int(Rows.size()); r++)
+        for (int side = 0; side < 2; side++)
+            if (Rows[r].node[side] >= 0) {
+                Node& node = Nodes[Rows[r].node[side]];
+                NodeRows[node.first + node.count++] = r;
+            }
+
+    // A = J M⁻¹ Jᵀ (padding rows keep an identity diagonal)
+    for (Row& row : Rows) {
+        for (int i = row.dim; i < 3; i++) row.D.m[i][i] = 1.0;
+        for (int side = 0; side < 2; side++)
+            if (row.node[side] >= 0) {
+                Block3 d = CouplingBlock(row.J[side], row.J[side], Nodes[row.node[side]]);
+                for (int i = 0; i < row.dim; i++)
+                    for (int j = 0; j < row.dim; j++)
+                        row.D.m[i][j] += d.m[i][j];
+            }
+    }
+
+    for (int n = 0; n < int(Nodes.size()); n++) {
+        const Node& node = Nodes[n];
+        for (int x = 0; x < node.count; x++)
+            for (int y = 0; y < node.count; y++) {
+                if (x == y) continue;
+                const Row& rx = Rows[NodeRows[node.first + x]];
+                const Row& ry = Rows[NodeRows[node.first + y]];
+                BlockAt(node, x, y) = CouplingBlock(rx.J[SideOf(rx, n)], ry.J[SideOf(ry, n)], node);
+            }
+    }
+
+    // DFS post-order per connected group: a row is emitted once the subtree below it is done,
+    // its parent is the node it was reached from
+    NodeState.assign(Nodes.size(), 0);
+    RowSeen.assign(Rows.size(), 0);
+    Stack.clear();
+
+    for (int root = 0; root < int(Nodes.size()); root++) {
+        if (NodeState[root]) continue;
+
+        bool tree = true;
+        GroupRows.clear();
+        Stack.push_back({root, -1, 0});
+        NodeState[root] = 1;
+
+        while (!Stack.empty()) {
+            Frame& f = Stack.back();
+            const Node& node = Nodes[f.node];
+
+            if (f.next < node.count) {
+                int r = NodeRows[node.first + f.next++];
+                if (r == f.via || RowSeen[r]) continue;
+                RowSeen[r] = 1;
+
+                Row& row = Rows[r];
+                row.parent = f.node;
+                int other = row.node[1 - SideOf(row, f.node)];
+
+                if (other < 0) {
+                    GroupRows.push_back(r);             // pinned to the world: leaf
+                }
+                else if (NodeState[other]) {
+                    tree = false;                       // loop
+                    GroupRows.push_back(r);
+                }
+                else {
+                    NodeState[other] = 1;
+                    Stack.push_back({other, r, 0});
+                }
+                continue;
+            }
+
+            int via = f.via;
+            NodeState[f.node] = 2;
+            Stack.pop_back();
+            if (via >= 0) GroupRows.push_back(via);
+        }
+
+        for (int r : GroupRows) {
+            Rows[r].tree = tree;
+            Rows[r].slot = SlotOf(Nodes[Rows[r].parent], r);
+            if (tree) {
+                Rows[r].order = int(Order.size());
+                Order.push_back(r);
+            }
+        }
+    }
+
+    // Factor: eliminate rows in order, updating the blocks of the parent node
+    // (loop rows keep their plain diagonal inverse for Gauss-Seidel)
+    for (Row& row : Rows) row.Dinv = Inverse(row.D);
+
+    for (int r : Order) {
+        Row& row = Rows[r];
+        row.Dinv = Inverse(row.D);
+        const Node& node = Nodes[row.parent];
+        int slot = row.slot;
+
+        for (int x = 0; x < node.count; x++) {
+            Row& rx = Rows[NodeRows[node.first + x]];
+            if (x == slot || rx.order < row.order) continue;
+
+            // L_xi = A_xi D_i⁻¹
+            Block3 L = Multiply(BlockAt(node, x, slot), row.Dinv);
+
+            for (int y = 0; y < node.count; y++) {
+                Row& ry = Rows[NodeRows[node.first + y]];
+                if (y == slot || ry.order < row.order) continue;
+
+                Block3 update = Multiply(L, BlockAt(node, slot, y));
+                if (x == y) {
+                    for (int i = 0; i < rx.dim; i++)
+                        for (int j = 0; j < rx.dim; j++)
+                            rx.D.m[i][j] -= update.m[i][j];
+                }
+                else Subtract(BlockAt(node, x, y), update);
+            }
+        }
+    }
+
+    Rhs.resize(Rows.size());
+    Lambda.resize(Rows.size());
+}
+
+// -------------------- Solve -------------------
+void PhysicsWorld::JointSystem::DirectSolver::Solve()
+{
+    if (Rows.empty()) return;
+
+    for (size_t r = 0; r < Rows.size(); r++) {
+        Rhs[r] = RowRhs(Rows[r]);
+        Lambda[r] = Vec3();
+    }
+
+    // Forward: y_x -= A_xi D_i⁻¹ y_i for the later neighbours of i
+    for (int r : Order) {
+        const Row& row = Rows[r];
+        const Node& node = Nodes[row.parent];
+        int slot = row.slot;
+        Vec3 z = Multiply(row.Dinv, Rhs[r]);
+
+        for (int x = 0; x < node.count; x++) {
+            int rx = NodeRows[node.first + x];
+            if (x == slot || Rows[rx].order < row.order) continue;
+            Vec3 d = Multiply(BlockAt(node, x, slot), z);
+            for (int i = 0; i < 3; i++) Rhs[rx].v[i] -= d.v[i];
+        }
+    }
+
+    // Back: λ_i = D_i⁻¹ (y_i - Σ A_ix λ_x)
+    for (auto it = Order.rbegin(); it != Order.rend(); ++it) {
+        int r = *it;
+        const Row& row = Rows[r];
+        const Node& node = Nodes[row.parent];
+        int slot = row.slot;
+        Vec3 y = Rhs[r];
+
+        for (int x = 0; x < node.count; x++) {
+            int rx = NodeRows[node.first + x];
+            if (x == slot || Rows[rx].order < row.order) continue;
+            Vec3 d = Multiply(BlockAt(node, slot, x), Lambda[rx]);
+            for (int i = 0; i < 3; i++) y.v[i] -= d.v[i];
+        }
+        Lambda[r] = Multiply(row.Dinv, y);
+    }
+
+    for (int r : Order) ApplyRowImpulse(Rows[r], Lambda[r]);
+
+    // Loops: block Gauss-Seidel on the unfactored rows
+    for (Row& row : Rows) {
+        if (row.tree) continue;
+        ApplyRowImpulse(row, Multiply(row.Dinv, RowRhs(row)));
+    }
+}
+
+// ------------------ JointSystem ---------------
+PhysicsWorld::JointSystem::JointSystem(PhysicsWorld& _world) : Direct(std::make_unique<DirectSolver>()), world(_world) {}
+PhysicsWorld::JointSystem::~JointSystem() = default;
+
+void PhysicsWorld::JointSystem::PrepareDirect()
+{
+    Direct->Prepare(*this, world.RigidBodies.Store.Size());
+}
+
+void PhysicsWorld::JointSystem::SolveDirect()
+{
+    Direct->Solve();
+}
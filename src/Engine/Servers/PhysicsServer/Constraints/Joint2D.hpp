@@ -0,0 +1,115 @@
+#pragma once
+#include <Math/Math.hpp>
+#include <Engine/Memory/ObjectPool.hpp>
+
+class RigidBody2D;
+
+enum class JointType2D : uint8_t {
+    Distance,
+    Spring,
+    Revolute,
+    Prismatic,
+    Weld
+};
+
+constexpr size_t JointTypeCount2D = 5;
+
+// Stable reference to a joint: names a slot of its type's slot table, which follows the joint
+// while its bucket is compacted. Stale once the joint is removed or pruned, even if the slot is reused.
+struct JointHandle2D {
+    JointType2D type = JointType2D::Distance;
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+};
+
+// Slot -> bucket index indirection of one joint type (kept in step with the bucket by JointSystem)
+struct JointSlots2D {
+    struct Slot {
+        uint32_t index = UINT32_MAX;    // bucket index, UINT32_MAX while free
+        uint32_t generation = 0;        // bumped on release
+    };
+    std::vector<Slot> slots;
+    std::vector<uint32_t> slotOfIndex;  // bucket index -> slot
+    std::vector<uint32_t> freeSlots;
+
+    uint32_t Insert(uint32_t index);            // the joint appended at index, returns its slot
+    uint32_t Find(JointHandle2D handle) const;  // bucket index, or UINT32_MAX if stale
+    void Release(uint32_t index);               // the joint at index is being dropped
+    void Move(uint32_t from, uint32_t to);      // the joint at from now lives at to
+    void Clear();
+};
+
+// Bodies + anchors shared by every joint type.
+// A null bodyB pins the joint to a fixed world point (localAnchorB is then in world space).
+// The handles outlive the bodies: a joint whose body was destroyed is dropped at the next step.
+struct JointLink2D {
+    RigidBody2D* bodyA = nullptr;
+    RigidBody2D* bodyB = nullptr;
+    Handle<RigidBody2D> handleA, handleB;
+    glm::vec2 localAnchorA{0.0f};
+    glm::vec2 localAnchorB{0.0f};
+
+    // Solved exactly by the direct (tree) solver instead of the iterative loop
+    bool direct = false;
+
+    // Solver cache (refreshed every step)
+    glm::vec2 rA{0.0f};             // world space arm from A's center to the anchor
+    glm::vec2 rB{0.0f};             // world space arm from B's center to the anchor
+    float invMassA = 0.0f, invInertiaA = 0.0f;
+    float invMassB = 0.0f, invInertiaB = 0.0f;
+};
+
+// Keeps both anchors at a fixed distance (rigid rod)
+struct DistanceJoint2D : JointLink2D {
+    float length = 0.0f;
+
+    glm::vec2 axis{0.0f};
+    float mass = 0.0f;
+    float bias = 0.0f;
+    float impulse = 0.0f;
+};
+
+// Soft distance joint (damped spring)
+struct SpringJoint2D : JointLink2D {
+    float restLength = 0.0f;
+    float frequency = 4.0f;         // Hz
+    float dampingRatio = 0.5f;      // 0 = no damping, 1 = critical
+
+    glm::vec2 axis{0.0f};
+    float mass = 0.0f;
+    float bias = 0.0f;
+    float gamma = 0.0f;
+    float impulse = 0.0f;
+};
+
+// Pins both anchors together, rotation is free
+struct RevoluteJoint2D : JointLink2D {
+    glm::vec2 bias{0.0f};
+    glm::vec2 impulse{0.0f};
+    float K11 = 0.0f, K12 = 0.0f, K22 = 0.0f;
+};
+
+// Lets B slide along an axis fixed in A, rotation is locked
+struct PrismaticJoint2D : JointLink2D {
+    glm::vec2 localAxisA{1.0f, 0.0f};
+    float referenceAngle = 0.0f;    // radians
+
+    glm::vec2 perp{0.0f};
+    glm::vec2 armA{0.0f};           // d + rA, lever arm of the slide impulse on A
+    float s1 = 0.0f, s2 = 0.0f;     // cross(armA, perp), cross(rB, perp)
+    float linearMass = 0.0f, angularMass = 0.0f;
+    float linearBias = 0.0f, angularBias = 0.0f;
+    float linearImpulse = 0.0f, angularImpulse = 0.0f;
+};
+
+// Glues both bodies together (point + angle)
+struct WeldJoint2D : JointLink2D {
+    float referenceAngle = 0.0f;    // radians
+
+    glm::vec2 bias{0.0f};
+    float angularBias = 0.0f;
+    glm::vec2 impulse{0.0f};
+    float angularImpulse = 0.0f;
+    float K11 = 0.0f, K12 = 0.0f, K22 = 0.0f;
+    float angularMass = 0.0f;
+};
@@ -0,0 +1,534 @@
+#include <Engine/Servers/PhysicsServer/PhysicsWorld.hpp>
+
+/*
+Sequential impulses, every joint works on the relative velocity of its anchors:
+    Cdot = (vB + wB x rB) - (vA + wA x rA)
+and applies +P on B and -P on A. Position drift is fed back with a Baumgarte bias.
+*/
+
+static constexpr float Baumgarte = 0.2f;
+
+// ----------------- Helpers --------------------
+static glm::vec2 BodyPosition(RigidBody2D* body) { return body ? body->getPosition() : glm::vec2(0.0f); }
+static glm::vec2 BodyOrientation(RigidBody2D* body) { return body ? body->getOrientation() : glm::vec2(1.0f, 0.0f); }
+static float RelativeAngle(RigidBody2D* a, RigidBody2D* b) { return relative_angle(BodyOrientation(a), BodyOrientation(b)); }
+
+static glm::vec2 AnchorVelocity(RigidBody2D* body, const glm::vec2& r) {
+    if (!body) return glm::vec2(0.0f);
+    return body->getLinearVelocity() + body->getAngularVelocity() * perp(r);
+}
+
+static float AngularVelocity(RigidBody2D* body) { return body ? body->getAngularVelocity() : 0.0f; }
+
+static void ApplyLinear(JointLink2D& j, const glm::vec2& P, const glm::vec2& armA) {
+    if (j.bodyA) j.bodyA->ApplyImpulse(-P, armA);
+    if (j.bodyB) j.bodyB->ApplyImpulse(P, j.rB);
+}
+
+static void ApplyAngular(JointLink2D& j, float L) {
+    if (j.bodyA) j.bodyA->ApplyAngularImpulse(-L);
+    if (j.bodyB) j.bodyB->ApplyAngularImpulse(L);
+}
+
+// Refresh arms + mass properties, returns the world separation pB - pA
+static glm::vec2 PrepareLink(JointLink2D& j) {
+    // Attached bodies are static without a zero inverse mass in the store
+    const bool movesA = j.bodyA && !j.bodyA->IsStatic();
+    const bool movesB = j.bodyB && !j.bodyB->IsStatic();
+    j.invMassA = movesA ? j.bodyA->getInverseMass() : 0.0f;
+    j.invInertiaA = movesA ? j.bodyA->getInverseInertia() : 0.0f;
+    j.invMassB = movesB ? j.bodyB->getInverseMass() : 0.0f;
+    j.invInertiaB = movesB ? j.bodyB->getInverseInertia() : 0.0f;
+
+    j.rA = j.bodyA ? rotate_local_to_world(j.localAnchorA, j.bodyA->getOrientation()) : glm::vec2(0.0f);
+    j.rB = j.bodyB ? rotate_local_to_world(j.localAnchorB, j.bodyB->getOrientation()) : glm::vec2(0.0f);
+
+    glm::vec2 pA = (j.bodyA ? BodyPosition(j.bodyA) : j.localAnchorA) + j.rA;
+    glm::vec2 pB = (j.bodyB ? BodyPosition(j.bodyB) : j.localAnchorB) + j.rB;
+    return pB - pA;
+}
+
+// World anchor -> body local anchor (or the world point itself when there is no body)
+static glm::vec2 ToLocal(RigidBody2D* body, glm::vec2 worldAnchor) {
+    if (!body) return worldAnchor;
+    return rotate_world_to_local(worldAnchor - body->transform->position, body->transform->orientation);
+}
+
+static void PrepareAxis(JointLink2D& j, glm::vec2 d, glm::vec2& axis, float& K) {
+    float len = glm::length(d);
+    axis = (len > EPS) ? d / len : glm::vec2(1.0f, 0.0f);
+    float crA = cross(j.rA, axis);
+    float crB = cross(j.rB, axis);
+    K = j.invMassA + j.invInertiaA * crA * crA + j.invMassB + j.invInertiaB * crB * crB;
+}
+
+static void PreparePoint(JointLink2D& j, float& K11, float& K12, float& K22) {
+    const float mA = j.invMassA, iA = j.invInertiaA;
+    const float mB = j.invMassB, iB = j.invInertiaB;
+    K11 = mA + mB + iA * j.rA.y * j.rA.y + iB * j.rB.y * j.rB.y;
+    K12 = -iA * j.rA.x * j.rA.y - iB * j.rB.x * j.rB.y;
+    K22 = mA + mB + iA * j.rA.x * j.rA.x + iB * j.rB.x * j.rB.x;
+}
+
+static glm::vec2 SolvePoint(float K11, float K12, float K22, glm::vec2 rhs) {
+    float det = K11 * K22 - K12 * K12;
+    if (std::abs(det) < 1e-12f) return glm::vec2(0.0f);
+    det = 1.0f / det;
+    return {det * (K22 * rhs.x - K12 * rhs.y), det * (K11 * rhs.y - K12 * rhs.x)};
+}
+
+// ------------------- Handles ------------------
+uint32_t JointSlots2D::Insert(uint32_t index)
+{
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = uint32_t(slots.size());
+        slots.emplace_back();
+    }
+    slots[slot].index = index;
+    slotOfIndex.push_back(slot);
+    return slot;
+}
+
+uint32_t JointSlots2D::Find(JointHandle2D handle) const
+{
+    if (handle.slot >= slots.size()) return UINT32_MAX;
+    const Slot& slot = slots[handle.slot];
+    return slot.generation == handle.generation ? slot.index : UINT32_MAX;
+}
+
+void JointSlots2D::Release(uint32_t index)
+{
+    Slot& slot = slots[slotOfIndex[index]];
+    slot.index = UINT32_MAX;
+    slot.generation++;                  // invalidates every handle to this joint
+    freeSlots.push_back(slotOfIndex[index]);
+}
+
+void JointSlots2D::Move(uint32_t from, uint32_t to)
+{
+    slotOfIndex[to] = slotOfIndex[from];
+    slots[slotOfIndex[to]].index = to;
+}
+
+void JointSlots2D::Clear()
+{
+    for (uint32_t index = 0; index < slotOfIndex.size(); index++) Release(index);
+    slotOfIndex.clear();
+}
+
+// ------------------ Creation ------------------
+static void Link(JointLink2D& j, RigidBody2D* a, RigidBody2D* b) {
+    j.bodyA = a;
+    j.bodyB = b;
+    if (a) j.handleA = a->GetHandle();
+    if (b) j.handleB = b->GetHandle();
+}
+
+JointHandle2D PhysicsWorld::JointSystem::Issue(JointType2D type, uint32_t index)
+{
+    JointSlots2D& slots = Slots[size_t(type)];
+    const uint32_t slot = slots.Insert(index);
+    return {type, slot, slots.slots[slot].generation};
+}
+
+JointHandle2D PhysicsWorld::JointSystem::AddDistance(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchorA, glm::vec2 anchorB)
+{
+    DistanceJoint2D j;
+    Link(j, a, b);
+    j.localAnchorA = ToLocal(a, anchorA);
+    j.localAnchorB = ToLocal(b, anchorB);
+    j.length = glm::distance(anchorA, anchorB);
+    DistanceJoints.push_back(j);
+    return Issue(JointType2D::Distance, uint32_t(DistanceJoints.size() - 1));
+}
+
+JointHandle2D PhysicsWorld::JointSystem::AddSpring(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchorA, glm::vec2 anchorB, float frequency, float dampingRatio)
+{
+    SpringJoint2D j;
+    Link(j, a, b);
+    j.localAnchorA = ToLocal(a, anchorA);
+    j.localAnchorB = ToLocal(b, anchorB);
+    j.restLength = glm::distance(anchorA, anchorB);
+    j.frequency = frequency;
+    j.dampingRatio = dampingRatio;
+    SpringJoints.push_back(j);
+    return Issue(JointType2D::Spring, uint32_t(SpringJoints.size() - 1));
+}
+
+JointHandle2D PhysicsWorld::JointSystem::AddRevolute(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor)
+{
+    RevoluteJoint2D j;
+    Link(j, a, b);
+    j.localAnchorA = ToLocal(a, anchor);
+    j.localAnchorB = ToLocal(b, anchor);
+    RevoluteJoints.push_back(j);
+    return Issue(JointType2D::Revolute, uint32_t(RevoluteJoints.size() - 1));
+}
+
+JointHandle2D PhysicsWorld::JointSystem::AddPrismatic(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor, glm::vec2 axis)
+{
+    PrismaticJoint2D j;
+    Link(j, a, b);
+    j.localAnchorA = ToLocal(a, anchor);
+    j.localAnchorB = ToLocal(b, anchor);
+    j.localAxisA = glm::normalize(a ? rotate_world_to_local(axis, a->transform->orientation) : axis);
+    j.referenceAngle = RelativeAngle(a, b);
+    PrismaticJoints.push_back(j);
+    return Issue(JointType2D::Prismatic, uint32_t(PrismaticJoints.size() - 1));
+}
+
+JointHandle2D PhysicsWorld::JointSystem::AddWeld(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor)
+{
+    WeldJoint2D j;
+    Link(j, a, b);
+    j.localAnchorA = ToLocal(a, anchor);
+    j.localAnchorB = ToLocal(b, anchor);
+    j.referenceAngle = RelativeAngle(a, b);
+    WeldJoints.push_back(j);
+    return Issue(JointType2D::Weld, uint32_t(WeldJoints.size() - 1));
+}
+
+uint32_t PhysicsWorld::JointSystem::Find(JointHandle2D handle) const
+{
+    if (size_t(handle.type) >= JointTypeCount2D) return UINT32_MAX;
+    return Slots[size_t(handle.type)].Find(handle);
+}
+
+bool PhysicsWorld::JointSystem::Contains(JointHandle2D handle) const
+{
+    return Find(handle) != UINT32_MAX;
+}
+
+// Swap-and-pop, the moved joint's slot follows it
+template <typename T>
+static void RemoveAt(std::vector<T>& joints, JointSlots2D& slots, uint32_t index) {
+    const uint32_t last = uint32_t(joints.size() - 1);
+    slots.Release(index);
+    if (index != last) {
+        joints[index] = joints[last];
+        slots.Move(last, index);
+    }
+    joints.pop_back();
+    slots.slotOfIndex.pop_back();
+}
+
+void PhysicsWorld::JointSystem::Remove(JointHandle2D handle)
+{
+    const uint32_t index = Find(handle);
+    if (index == UINT32_MAX) return;
+    JointSlots2D& slots = Slots[size_t(handle.type)];
+    switch (handle.type) {
+        case JointType2D::Distance:  RemoveAt(DistanceJoints, slots, index); break;
+        case JointType2D::Spring:    RemoveAt(SpringJoints, slots, index); break;
+        case JointType2D::Revolute:  RemoveAt(RevoluteJoints, slots, index); break;
+        case JointType2D::Prismatic: RemoveAt(PrismaticJoints, slots, index); break;
+        case JointType2D::Weld:      RemoveAt(WeldJoints, slots, index); break;
+    }
+}
+
+void PhysicsWorld::JointSystem::SetDirect(JointHandle2D handle, bool direct)
+{
+    const uint32_t index = Find(handle);
+    if (index == UINT32_MAX) return;
+    JointLink2D* link = nullptr;
+    switch (handle.type) {
+        case JointType2D::Distance:  link = &DistanceJoints[index]; DistanceJoints[index].impulse = 0.0f; break;
+        case JointType2D::Revolute:  link = &RevoluteJoints[index]; RevoluteJoints[index].impulse = glm::vec2(0.0f); break;
+        case JointType2D::Prismatic:
+            link = &PrismaticJoints[index];
+            PrismaticJoints[index].linearImpulse = 0.0f;
+            PrismaticJoints[index].angularImpulse = 0.0f;
+            break;
+        case JointType2D::Weld:
+            link = &WeldJoints[index];
+            WeldJoints[index].impulse = glm::vec2(0.0f);
+            WeldJoints[index].angularImpulse = 0.0f;
+            break;
+        case JointType2D::Spring: break; // soft, always iterative
+    }
+    if (link) link->direct = direct;
+}
+
+// A link is alive while its bodies still resolve (a destroyed body's slot may be reused already)
+static bool LinkAlive(const JointLink2D& j) {
+    return (!j.bodyA || RigidBody2D::Resolve(j.handleA) == j.bodyA) &&
+           (!j.bodyB || RigidBody2D::Resolve(j.handleB) == j.bodyB);
+}
+
+// Stable compaction (keeps the solve order), the slots of the survivors follow them down
+template <typename T>
+static void Prune(std::vector<T>& joints, JointSlots2D& slots) {
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < joints.size(); i++) {
+        if (!LinkAlive(joints[i])) {
+            slots.Release(i);
+            continue;
+        }
+        if (kept != i) {
+            joints[kept] = joints[i];
+            slots.Move(i, kept);
+        }
+        kept++;
+    }
+    joints.erase(joints.begin() + kept, joints.end());
+    slots.slotOfIndex.resize(kept);
+}
+
+void PhysicsWorld::JointSystem::Prune()
+{
+    ::Prune(DistanceJoints, Slots[size_t(JointType2D::Distance)]);
+    ::Prune(SpringJoints, Slots[size_t(JointType2D::Spring)]);
+    ::Prune(RevoluteJoints, Slots[size_t(JointType2D::Revolute)]);
+    ::Prune(PrismaticJoints, Slots[size_t(JointType2D::Prismatic)]);
+    ::Prune(WeldJoints, Slots[size_t(JointType2D::Weld)]);
+}
+
+void PhysicsWorld::JointSystem::Clear()
+{
+    DistanceJoints.clear();
+    SpringJoints.clear();
+    RevoluteJoints.clear();
+    PrismaticJoints.clear();
+    WeldJoints.clear();
+    for (JointSlots2D& slots : Slots) slots.Clear();
+}
+
+// ------------------- Prepare ------------------
+// Computes arms, effective masses and bias, then warm starts with last step's impulses
+void PhysicsWorld::JointSystem::Prepare(float delta)
+{
+    const float invDelta = (delta > 0.0f) ? 1.0f / delta : 0.0f;
+
+    for (DistanceJoint2D& j : DistanceJoints) {
+        glm::vec2 d = PrepareLink(j);
+        float K;
+        PrepareAxis(j, d, j.axis, K);
+        j.mass = (K > 0.0f) ? 1.0f / K : 0.0f;
+        j.bias = Baumgarte * invDelta * (glm::length(d) - j.length);
+
+        ApplyLinear(j, j.impulse * j.axis, j.rA);
+    }
+
+    for (SpringJoint2D& j : SpringJoints) {
+        glm::vec2 d = PrepareLink(j);
+        float K;
+        PrepareAxis(j, d, j.axis, K);
+        float C = glm::length(d) - j.restLength;
+
+        // Soft constraint: k = m * ω², c = 2 * m * ζ * ω
+        float m = (K > 0.0f) ? 1.0f / K : 0.0f;
+        float omega = 2.0f * PI * j.frequency;
+        float k = m * omega * omega;
+        float c = 2.0f * m * j.dampingRatio * omega;
+
+        j.gamma = delta * (c + delta * k);
+        j.gamma = (j.gamma > 0.0f) ? 1.0f / j.gamma : 0.0f;
+        j.bias = C * delta * k * j.gamma;
+        j.mass = (K + j.gamma > 0.0f) ? 1.0f / (K + j.gamma) : 0.0f;
+
+        ApplyLinear(j, j.impulse * j.axis, j.rA);
+    }
+
+    for (RevoluteJoint2D& j : RevoluteJoints) {
+        glm::vec2 d = PrepareLink(j);
+        PreparePoint(j, j.K11, j.K12, j.K22);
+        j.bias = Baumgarte * invDelta * d;
+
+        ApplyLinear(j, j.impulse, j.rA);
+    }
+
+    for (PrismaticJoint2D& j : PrismaticJoints) {
+        glm::vec2 d = PrepareLink(j);
+        glm::vec2 axis = j.bodyA ? rotate_local_to_world(j.localAxisA, j.bodyA->getOrientation()) : j.localAxisA;
+        j.perp = perp(axis);
+        j.armA = d + j.rA;
+        j.s1 = cross(j.armA, j.perp);
+        j.s2 = cross(j.rB, j.perp);
+
+        float K = j.invMassA + j.invMassB + j.invInertiaA * j.s1 * j.s1 + j.invInertiaB * j.s2 * j.s2;
+        float KA = j.invInertiaA + j.invInertiaB;
+        j.linearMass = (K > 0.0f) ? 1.0f / K : 0.0f;
+        j.angularMass = (KA > 0.0f) ? 1.0f / KA : 0.0f;
+        j.linearBias = Baumgarte * invDelta * glm::dot(j.perp, d);
+        j.angularBias = Baumgarte * invDelta * wrap_angle(RelativeAngle(j.bodyA, j.bodyB) - j.referenceAngle);
+
+        ApplyLinear(j, j.linearImpulse * j.perp, j.armA);
+        ApplyAngular(j, j.angularImpulse);
+    }
+
+    for (WeldJoint2D& j : WeldJoints) {
+        glm::vec2 d = PrepareLink(j);
+        PreparePoint(j, j.K11, j.K12, j.K22);
+        float KA = j.invInertiaA + j.invInertiaB;
+        j.angularMass = (KA > 0.0f) ? 1.0f / KA : 0.0f;
+        j.bias = Baumgarte * invDelta * d;
+        j.angularBias = Baumgarte * invDelta * wrap_angle(RelativeAngle(j.bodyA, j.bodyB) - j.referenceAngle);
+
+        ApplyLinear(j, j.impulse, j.rA);
+        ApplyAngular(j, j.angularImpulse);
+    }
+}
+
+// -------------------- Solve -------------------
+// One velocity iteration over every bucket (called from the shared solver loop).
+// Returns the worst velocity error met before correction (springs are soft, not counted).
+float PhysicsWorld::JointSystem::Solve()
+{
+    float residual = 0.0f;
+
+    for (DistanceJoint2D& j : DistanceJoints) {
+        if (j.direct) continue;
+        float Cdot = glm::dot(j.axis, AnchorVelocity(j.bodyB, j.rB) - AnchorVelocity(j.bodyA, j.rA));
+        float lambda = -j.mass * (Cdot + j.bias);
+        residual = std::max(residual, std::abs(Cdot + j.bias));
+        j.impulse += lambda;
+        ApplyLinear(j, lambda * j.axis, j.rA);
+    }
+
+    for (SpringJoint2D& j : SpringJoints) {
+        float Cdot = glm::dot(j.axis, AnchorVelocity(j.bodyB, j.rB) - AnchorVelocity(j.bodyA, j.rA));
+        float lambda = -j.mass * (Cdot + j.bias + j.gamma * j.impulse);
+        j.impulse += lambda;
+        ApplyLinear(j, lambda * j.axis, j.rA);
+    }
+
+    for (RevoluteJoint2D& j : RevoluteJoints) {
+        if (j.direct) continue;
+        glm::vec2 Cdot = AnchorVelocity(j.bodyB, j.rB) - AnchorVelocity(j.bodyA, j.rA);
+        glm::vec2 lambda = SolvePoint(j.K11, j.K12, j.K22, -(Cdot + j.bias));
+        residual = std::max(residual, glm::length(Cdot + j.bias));
+        j.impulse += lambda;
+        ApplyLinear(j, lambda, j.rA);
+    }
+
+    for (PrismaticJoint2D& j : PrismaticJoints) {
+        if (j.direct) continue;
+        float CdotA = AngularVelocity(j.bodyB) - AngularVelocity(j.bodyA);
+        float angular = -j.angularMass * (CdotA + j.angularBias);
+        residual = std::max(residual, std::abs(CdotA + j.angularBias));
+        j.angularImpulse += angular;
+        ApplyAngular(j, angular);
+
+        glm::vec2 vA = j.bodyA ? j.bodyA->getLinearVelocity() : glm::vec2(0.0f);
+        glm::vec2 vB = j.bodyB ? j.bodyB->getLinearVelocity() : glm::vec2(0.0f);
+        float Cdot = glm::dot(j.perp, vB - vA) + j.s2 * AngularVelocity(j.bodyB) - j.s1 * AngularVelocity(j.bodyA);
+        float linear = -j.linearMass * (Cdot + j.linearBias);
+        residual = std::max(residual, std::abs(Cdot + j.linearBias));
+        j.linearImpulse += linear;
+        ApplyLinear(j, linear * j.perp, j.armA);
+    }
+
+    for (WeldJoint2D& j : WeldJoints) {
+        if (j.direct) continue;
+        float CdotA = AngularVelocity(j.bodyB) - AngularVelocity(j.bodyA);
+        float angular = -j.angularMass * (CdotA + j.angularBias);
+        residual = std::max(residual, std::abs(CdotA + j.angularBias));
+        j.angularImpulse += angular;
+        ApplyAngular(j, angular);
+
+        glm::vec2 Cdot = AnchorVelocity(j.bodyB, j.rB) - AnchorVelocity(j.bodyA, j.rA);
+        glm::vec2 lambda = SolvePoint(j.K11, j.K12, j.K22, -(Cdot + j.bias));
+        residual = std::max(residual, glm::length(Cdot + j.bias));
+        j.impulse += lambda;
+        ApplyLinear(j, lambda, j.rA);
+    }
+
+    return residual;
+}
+
+// ------------------- Project ------------------
+// XPBD: moves the bodies directly, one projection per substep.
+// alpha = compliance / dt² (0 = rigid)
+
+static void MoveBody(RigidBody2D* body, const glm::vec2& p, const glm::vec2& r, float invMass, float invInertia) {
+    if (!body || (invMass == 0.0f && invInertia == 0.0f)) return;
+    body->setPosition(body->getPosition() + p * invMass);
+    body->Rotate(cross(r, p) * invInertia);
+}
+
+static void ProjectAlong(JointLink2D& j, const glm::vec2& n, float C, const glm::vec2& armA, float alpha, float damping = 0.0f) {
+    float crA = cross(armA, n);
+    float crB = cross(j.rB, n);
+    float w = j.invMassA + j.invInertiaA * crA * crA + j.invMassB + j.invInertiaB * crB * crB;
+    if (w + alpha <= 0.0f) return;
+
+    float lambda = -(C + damping) / (w + alpha);
+    glm::vec2 p = lambda * n;
+    MoveBody(j.bodyA, -p, armA, j.invMassA, j.invInertiaA);
+    MoveBody(j.bodyB, p, j.rB, j.invMassB, j.invInertiaB);
+}
+
+static void ProjectAngle(JointLink2D& j, float C, float alpha) {
+    float w = j.invInertiaA + j.invInertiaB;
+    if (w + alpha <= 0.0f) return;
+
+    float lambda = -C / (w + alpha);
+    if (j.bodyA && j.invInertiaA > 0.0f) j.bodyA->Rotate(-lambda * j.invInertiaA);
+    if (j.bodyB && j.invInertiaB > 0.0f) j.bodyB->Rotate(lambda * j.invInertiaB);
+}
+
+void PhysicsWorld::JointSystem::Project(float delta, float compliance)
+{
+    const float alpha = (delta > 0.0f) ? compliance / (delta * delta) : 0.0f;
+
+    for (DistanceJoint2D& j : DistanceJoints) {
+        glm::vec2 d = PrepareLink(j);
+        float len = glm::length(d);
+        if (len < EPS) continue;
+        ProjectAlong(j, d / len, len - j.length, j.rA, alpha);
+    }
+
+    for (SpringJoint2D& j : SpringJoints) {
+        glm::vec2 d = PrepareLink(j);
+        float len = glm::length(d);
+        if (len < EPS) continue;
+        glm::vec2 n = d / len;
+
+        // Compliance from the spring frequency: α = 1 / k, k = m * ω²
+        float crA = cross(j.rA, n);
+        float crB = cross(j.rB, n);
+        float w = j.invMassA + j.invInertiaA * crA * crA + j.invMassB + j.invInertiaB * crB * crB;
+        if (w <= 0.0f) continue;
+        float omega = 2.0f * PI * j.frequency;
+        float springAlpha = w / (omega * omega * delta * delta);
+
+        // XPBD damping: γ = α̃ * β * dt, scaled by the anchor motion this substep
+        float beta = 2.0f * j.dampingRatio * omega / w;
+        float gamma = springAlpha * beta * delta;
+        float motion = glm::dot(n, AnchorVelocity(j.bodyB, j.rB) - AnchorVelocity(j.bodyA, j.rA)) * delta;
+
+        // (1 + γ) w + α̃ folded into ProjectAlong's denominator
+        ProjectAlong(j, n, len - j.restLength, j.rA, gamma * w + springAlpha, gamma * motion);
+    }
+
+    for (RevoluteJoint2D& j : RevoluteJoints) {
+        glm::vec2 d = PrepareLink(j);
+        float len = glm::length(d);
+        if (len < EPS) continue;
+        ProjectAlong(j, d / len, len, j.rA, alpha);
+    }
+
+    for (PrismaticJoint2D& j : PrismaticJoints) {
+        PrepareLink(j);
+        ProjectAngle(j, wrap_angle(RelativeAngle(j.bodyA, j.bodyB) - j.referenceAngle), alpha);
+
+        glm::vec2 d = PrepareLink(j);
+        glm::vec2 axis = j.bodyA ? rotate_local_to_world(j.localAxisA, j.bodyA->getOrientation()) : j.localAxisA;
+        glm::vec2 n = perp(axis);
+        ProjectAlong(j, n, glm::dot(n, d), d + j.rA, alpha);
+    }
+
+    for (WeldJoint2D& j : WeldJoints) {
+        PrepareLink(j);
+        ProjectAngle(j, wrap_angle(RelativeAngle(j.bodyA, j.bodyB) - j.referenceAngle), alpha);
+
+        glm::vec2 d = PrepareLink(j);
+        float len = glm::length(d);
+        if (len < EPS) continue;
+        ProjectAlong(j, d / len, len, j.rA, alpha);
+    }
+}
@@ -0,0 +1,135 @@
+#include "PhysicsWorld.hpp"
+#include <algorithm>
+
+/*
+Contact events from persistent pair state:
+    Record()    after each solve pass (SI: once, XPBD: every substep), one Touch per touching pair,
+                read from the collider infos with the impulse the solver summed into them
+    Publish()   sort the Touches by (pair key, order), merge the duplicates of a pair (impulses add
+                up, the last substep gives the geometry), then walk them alongside last step's sorted
+                pairs: only in this step -> Begin, in both -> Persist, only in the last -> End once it
+                has been apart for more than EndDelay steps (silent until then) or a collider is gone.
+                Pairs that did not move under LOD (Held) are carried over silently, not counted apart
+Pairs are keyed by creation ids, so the event order is the same in every run.
+Everything is kept in vectors that only grow: no allocations once the contact count settles.
+*/
+
+void PhysicsWorld::ContactSystem::Record()
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+
+    for (size_t i = 0; i < store.Size(); i++) {
+        RigidBody2D* obj = store.owners[i];
+        if (!obj->collision) continue;
+        const Collision2DInfos& info = obj->collision->info;
+        if (!info.isPhysicsColliding) continue;
+
+        for (size_t slot = 0; slot < info.PhysicsColliders.size(); slot++) {
+            Collision2D* self = obj->collision;
+            Collision2D* other = info.PhysicsColliders[slot];
+            std::span<const glm::vec2> points = info.ContactPoints[slot];
+
+            glm::vec2 point = obj->getPosition();
+            if (!points.empty()) {
+                point = glm::vec2(0.0f);
+                for (const glm::vec2& p : points) point += p;
+                point /= float(points.size());
+            }
+
+            // The MTV pushes the info owner out; A is the lower id
+            glm::vec2 mtv = info.MTV[slot];
+            float length = glm::length(mtv);
+            glm::vec2 normal = length > 1e-8f ? mtv / length : glm::vec2(0.0f);
+            if (other->id < self->id) {
+                std::swap(self, other);
+                normal = -normal;
+            }
+
+            Touch touch;
+            touch.key = (uint64_t(self->id) << 32) | other->id;
+            touch.order = uint32_t(Staged.size());
+            touch.a = self;
+            touch.b = other;
+            touch.normal = normal;
+            touch.point = point;
+            touch.impulse = std::abs(info.Impulse[slot]);
+            Staged.push_back(touch);
+        }
+    }
+}
+
+// Nothing in the pair moved this step: an idle body under LOD against an idle or static one.
+// Such a pair may not even be tested (SkipsPair), and keeps whatever state it had.
+bool PhysicsWorld::ContactSystem::Held(const Collision2D* a, const Collision2D* b) const
+{
+    if (!world.LOD.Enabled) return false;
+    const RigidBody2D* bodyA = RigidBody2D::FromCollision(a);
+    const RigidBody2D* bodyB = RigidBody2D::FromCollision(b);
+    auto still = [this](const RigidBody2D* body) { return !body || body->IsStatic() || world.LOD.Idle(body); };
+    return (world.LOD.Idle(bodyA) || world.LOD.Idle(bodyB)) && still(bodyA) && still(bodyB);
+}
+
+void PhysicsWorld::ContactSystem::Publish()
+{
+    std::sort(Staged.begin(), Staged.end(), [](const Touch& a, const Touch& b) {
+        if (a.key != b.key) return a.key < b.key;
+        return a.order < b.order;
+    });
+
+    // One Touch per pair
+    size_t count = 0;
+    for (size_t i = 0; i < Staged.size(); count++) {
+        Touch merged = Staged[i];
+        float impulse = 0.0f;
+        for (; i < Staged.size() && Staged[i].key == merged.key; i++) {
+            impulse += Staged[i].impulse;
+            merged.normal = Staged[i].normal;
+            merged.point = Staged[i].point;
+        }
+        merged.impulse = impulse;
+        Staged[count] = merged;
+    }
+    Staged.resize(count);
+
+    Events.clear();
+    Next.clear();
+    size_t previous = 0;
+    auto emit = [&](ContactPhase2D phase, const Touch& touch) {
+        Events.push_back({phase, touch.a, touch.b, touch.normal, touch.point, touch.impulse});
+    };
+    auto ended = [&](const Pair& pair) {
+        Collision2D* a = Collision2D::Resolve(pair.a);
+        Collision2D* b = Collision2D::Resolve(pair.b);
+        if (a && b && Held(a, b)) Next.push_back(pair);
+        else if (a && b && pair.missed < EndDelay) Next.push_back({pair.key, pair.a, pair.b, pair.missed + 1});
+        else Events.push_back({ContactPhase2D::End, a, b});
+    };
+
+    for (const Touch& touch : Staged) {
+        while (previous < Touching.size() && Touching[previous].key < touch.key) ended(Touching[previous++]);
+
+        if (previous < Touching.size() && Touching[previous].key == touch.key) {
+            if (ReportPersist) emit(ContactPhase2D::Persist, touch);
+            previous++;
+        }
+        else {
+            emit(ContactPhase2D::Begin, touch);
+        }
+        Next.push_back({touch.key, touch.a->GetHandle(), touch.b->GetHandle(), 0});
+    }
+    while (previous < Touching.size()) ended(Touching[previous++]);
+
+    std::swap(Touching, Next);
+    Staged.clear();
+
+    if (Events.empty()) return;
+    for (auto& listener : Listeners) listener(Events);
+}
+
+void PhysicsWorld::ContactSystem::Reset()
+{
+    Staged.clear();
+    Touching.clear();
+    Next.clear();
+    Events.clear();
+}
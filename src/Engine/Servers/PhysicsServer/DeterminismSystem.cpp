@@ -0,0 +1,76 @@
+#include "PhysicsWorld.hpp"
+#include <fstream>
+#include <cstring>
+
+/*
+Determinism relies on:
+    - pairs solved in creation id order (CollisionSystem::Detect)
+    - bodies solved in store order, joints in bucket order
+    - no contracted / reassociated float math (FZX_STRICT_FP in CMake)
+The hash covers the bit patterns of every body pose and velocity, so any divergence
+shows up on the step it happens.
+*/
+
+static constexpr uint64_t FNVOffset = 14695981039346656037ull;
+static constexpr uint64_t FNVPrime = 1099511628211ull;
+
+static inline uint64_t HashFloat(uint64_t hash, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; i++) {
+        hash ^= (bits >> (8 * i)) & 0xFF;
+        hash *= FNVPrime;
+    }
+    return hash;
+}
+
+uint64_t PhysicsWorld::DeterminismSystem::Hash() const
+{
+    const RigidBodyStore& store = world.RigidBodies.Store;
+    uint64_t hash = FNVOffset;
+
+    for (size_t i = 0; i < store.Size(); i++) {
+        hash = HashFloat(hash, store.positionX[i]);
+        hash = HashFloat(hash, store.positionY[i]);
+        hash = HashFloat(hash, store.rotationCos[i]);
+        hash = HashFloat(hash, store.rotationSin[i]);
+        hash = HashFloat(hash, store.velocityX[i]);
+        hash = HashFloat(hash, store.velocityY[i]);
+        hash = HashFloat(hash, store.angularVelocity[i]);
+    }
+    return hash;
+}
+
+void PhysicsWorld::DeterminismSystem::Record()
+{
+    History.push_back(Hash());
+}
+
+int64_t PhysicsWorld::DeterminismSystem::FirstDivergence(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b)
+{
+    const size_t count = std::min(a.size(), b.size());
+    for (size_t i = 0; i < count; i++)
+        if (a[i] != b[i]) return int64_t(i);
+    return -1;
+}
+
+// ----------------- Persistence ----------------
+// Raw little endian uint64 per step, to compare runs across processes / machines
+bool PhysicsWorld::DeterminismSystem::SaveHistory(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char*>(History.data()), std::streamsize(History.size() * sizeof(uint64_t)));
+    return bool(file);
+}
+
+bool PhysicsWorld::DeterminismSystem::LoadHistory(const std::string& path, std::vector<uint64_t>& history)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    const std::streamsize size = file.tellg();
+    file.seekg(0);
+    history.resize(size_t(size) / sizeof(uint64_t));
+    file.read(reinterpret_cast<char*>(history.data()), std::streamsize(history.size() * sizeof(uint64_t)));
+    return bool(file);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <Math/Math.hpp>
+
+// Structure-of-arrays storage for the SPH particles (see PhysicsWorld::FluidSystem).
+// Particles are reordered by grid cell every step, indices are not stable.
+class FluidStore {
+public:
+    // State
+    std::vector<float> positionX, positionY;
+    std::vector<float> velocityX, velocityY;
+
+    // Per step (recomputed by the density / force passes)
+    std::vector<float> density, pressure;
+    std::vector<float> accelerationX, accelerationY;
+
+    uint32_t Add(glm::vec2 position, glm::vec2 velocity = glm::vec2(0.0f)) {
+        const uint32_t index = static_cast<uint32_t>(positionX.size());
+        positionX.push_back(position.x);
+        positionY.push_back(position.y);
+        velocityX.push_back(velocity.x);
+        velocityY.push_back(velocity.y);
+        return index;
+    }
+
+    void Reserve(size_t count) {
+        for (std::vector<float>* lane : StateArrays()) lane->reserve(count);
+    }
+
+    void Clear() {
+        for (std::vector<float>* lane : StateArrays()) lane->clear();
+    }
+
+    size_t Size() const { return positionX.size(); }
+
+    // Persistent lanes, the ones that follow the cell reordering
+    std::array<std::vector<float>*, 4> StateArrays() {
+        return {&positionX, &positionY, &velocityX, &velocityY};
+    }
+};
@@ -0,0 +1,307 @@
+#include "PhysicsWorld.hpp"
+#include <Engine/Servers/JobServer/JobServer.hpp>
+#include <Engine/Renderer/2D/Renderer2D.hpp>
+
+/*
+SPH (weakly compressible, 2D kernels):
+    ρi = Σ m W(r)                                       poly6
+    pi = k (ρi - ρ0)
+    ai = -Σ m (pi/ρi² + pj/ρj²) ∇W(r)                   spiky gradient
+         + μ/ρi Σ m (vj - vi)/ρj ∇²W(r)                 viscosity laplacian
+         + g
+Neighbours come from a uniform grid (cell = h) rebuilt by counting sort. The particle
+arrays are reordered by cell, so every neighbour cell is a contiguous run of memory.
+Density and force passes run on the JobServer.
+*/
+
+// Grid cell of a position (clamped to the bounds)
+static inline int CellCoord(float value, float min, float invCell, int count) {
+    return std::clamp(int((value - min) * invCell), 0, count - 1);
+}
+
+void PhysicsWorld::FluidSystem::Spawn(glm::vec2 position, glm::vec2 velocity)
+{
+    Particles.Add(position, velocity);
+}
+
+void PhysicsWorld::FluidSystem::SpawnBlock(glm::vec2 min, glm::vec2 max, float spacing)
+{
+    if (spacing <= 0.0f) return;
+    for (float y = min.y; y <= max.y; y += spacing)
+        for (float x = min.x; x <= max.x; x += spacing)
+            Particles.Add({x, y});
+}
+
+void PhysicsWorld::FluidSystem::Step(float delta)
+{
+    if (Particles.Size() == 0) return;
+
+    // CFL: the pressure wave (c = √k) must not cross more than ~0.4 h per substep
+    const float maxStep = 0.4f * SmoothingRadius / std::sqrt(std::max(Stiffness, 1.0f));
+    const int needed = int(std::ceil(delta / maxStep));
+    const int substeps = std::clamp(needed, std::max(Substeps, 1), std::max(MaxSubsteps, Substeps));
+    const float h = delta / float(substeps);
+
+    for (int substep = 0; substep < substeps; substep++) {
+        BuildGrid();
+        ComputeDensity();
+        ComputeForces();
+        Integrate(h);
+        if (Coupling != FluidCoupling::None) CoupleBodies();
+    }
+}
+
+// -------------------- Grid --------------------
+void PhysicsWorld::FluidSystem::BuildGrid()
+{
+    const size_t count = Particles.Size();
+    const float invCell = 1.0f / SmoothingRadius;
+    GridWidth = std::max(1, int(std::ceil(Bounds.getSize().x * invCell)));
+    GridHeight = std::max(1, int(std::ceil(Bounds.getSize().y * invCell)));
+
+    // Counting sort: histogram, prefix sum, scatter
+    CellStart.assign(size_t(GridWidth) * GridHeight + 1, 0);
+    CellOf.resize(count);
+    Order.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        int cx = CellCoord(Particles.positionX[i], Bounds.min.x, invCell, GridWidth);
+        int cy = CellCoord(Particles.positionY[i], Bounds.min.y, invCell, GridHeight);
+        CellOf[i] = uint32_t(cy * GridWidth + cx);
+        CellStart[CellOf[i] + 1]++;
+    }
+
+    for (size_t c = 1; c < CellStart.size(); c++) CellStart[c] += CellStart[c - 1];
+
+    // Order[i] = sorted slot of particle i (stable inside a cell)
+    Cursor.assign(CellStart.begin(), CellStart.end() - 1);
+    for (size_t i = 0; i < count; i++) Order[i] = Cursor[CellOf[i]]++;
+
+    Scratch.resize(count);
+    for (std::vector<float>* lane : Particles.StateArrays()) {
+        for (size_t i = 0; i < count; i++) Scratch[Order[i]] = (*lane)[i];
+        lane->swap(Scratch);
+    }
+
+    Particles.density.resize(count);
+    Particles.pressure.resize(count);
+    Particles.accelerationX.resize(count);
+    Particles.accelerationY.resize(count);
+}
+
+// Calls fn(j) for every particle in the 3x3 cells around the (sorted) particle i
+template <typename Fn>
+static inline void ForNeighbours(const FluidStore& p, size_t i, const std::vector<uint32_t>& cellStart,
+                                 int width, int height, float minX, float minY, float invCell, Fn&& fn)
+{
+    const int cx = CellCoord(p.positionX[i], minX, invCell, width);
+    const int cy = CellCoord(p.positionY[i], minY, invCell, height);
+    for (int y = std::max(cy - 1, 0); y <= std::min(cy + 1, height - 1); y++) {
+        // Cells of a row are adjacent in the sorted arrays: one run per row
+        const size_t row = size_t(y) * width;
+        const uint32_t begin = cellStart[row + std::max(cx - 1, 0)];
+        const uint32_t end = cellStart[row + std::min(cx + 1, width - 1) + 1];
+        for (uint32_t j = begin; j < end; j++) fn(j);
+    }
+}
+
+// ------------------- Density ------------------
+void PhysicsWorld::FluidSystem::ComputeDensity()
+{
+    // Two captures keep the job's std::function in its inline buffer (no allocation per call)
+    const struct { float h2, poly6, invCell; } k = {
+        SmoothingRadius * SmoothingRadius,
+        4.0f / (PI * std::pow(SmoothingRadius, 8.0f)),
+        1.0f / SmoothingRadius,
+    };
+
+    JobServer::ParallelFor(Particles.Size(), 1024, [this, &k](size_t begin, size_t end) {
+        const auto [h2, poly6, invCell] = k;
+        FluidStore& p = Particles;
+        for (size_t i = begin; i < end; i++) {
+            const float xi = p.positionX[i], yi = p.positionY[i];
+            float density = 0.0f;
+
+            ForNeighbours(p, i, CellStart, GridWidth, GridHeight, Bounds.min.x, Bounds.min.y, invCell, [&](uint32_t j) {
+                const float dx = p.positionX[j] - xi;
+                const float dy = p.positionY[j] - yi;
+                const float d = h2 - (dx * dx + dy * dy);
+                if (d > 0.0f) density += d * d * d;
+            });
+
+            density *= ParticleMass * poly6;
+            p.density[i] = density;
+            p.pressure[i] = std::max(Stiffness * (density - RestDensity), 0.0f);
+        }
+    });
+}
+
+// ------------------- Forces -------------------
+void PhysicsWorld::FluidSystem::ComputeForces()
+{
+    const float hs = SmoothingRadius;
+    const struct { float hs, h2, spiky, laplacian, invCell; glm::vec2 gravity; } k = {
+        hs,
+        hs * hs,
+        -30.0f / (PI * std::pow(hs, 5.0f)),
+        40.0f / (PI * std::pow(hs, 5.0f)),
+        1.0f / hs,
+        world.Gravity * world.GravityDirection,
+    };
+
+    JobServer::ParallelFor(Particles.Size(), 1024, [this, &k](size_t begin, size_t end) {
+        const auto [hs, h2, spiky, laplacian, invCell, gravity] = k;
+        FluidStore& p = Particles;
+        for (size_t i = begin; i < end; i++) {
+            const float xi = p.positionX[i], yi = p.positionY[i];
+            const float vxi = p.velocityX[i], vyi = p.velocityY[i];
+            const float rhoi = p.density[i];
+            const float pi = p.pressure[i] / (rhoi * rhoi);
+            float px = 0.0f, py = 0.0f;     // pressure
+            float vx = 0.0f, vy = 0.0f;     // viscosity
+
+            ForNeighbours(p, i, CellStart, GridWidth, GridHeight, Bounds.min.x, Bounds.min.y, invCell, [&](uint32_t j) {
+                if (j == i) return;
+                const float dx = xi - p.positionX[j];
+                const float dy = yi - p.positionY[j];
+                const float r2 = dx * dx + dy * dy;
+                if (r2 >= h2 || r2 < 1e-12f) return;
+
+                const float r = std::sqrt(r2);
+                const float q = hs - r;
+                const float rhoj = p.density[j];
+
+                // ∇W = spiky (h - r)² r̂
+                const float grad = spiky * q * q / r;
+                const float shared = pi + p.pressure[j] / (rhoj * rhoj);
+                px -= shared * grad * dx;
+                py -= shared * grad * dy;
+
+                const float lap = laplacian * q / rhoj;
+                vx += (p.velocityX[j] - vxi) * lap;
+                vy += (p.velocityY[j] - vyi) * lap;
+            });
+
+            p.accelerationX[i] = ParticleMass * (px + Viscosity * vx / rhoi) + gravity.x;
+            p.accelerationY[i] = ParticleMass * (py + Viscosity * vy / rhoi) + gravity.y;
+        }
+    });
+}
+
+// ------------------ Integrate -----------------
+void PhysicsWorld::FluidSystem::Integrate(float delta)
+{
+    FluidStore& p = Particles;
+    const float bounce = -0.3f;
+
+    for (size_t i = 0, n = p.Size(); i < n; i++) {
+        float vx = p.velocityX[i] + p.accelerationX[i] * delta;
+        float vy = p.velocityY[i] + p.accelerationY[i] * delta;
+        float x = p.positionX[i] + vx * delta;
+        float y = p.positionY[i] + vy * delta;
+
+        // Bounds act as walls
+        if (x < Bounds.min.x) { x = Bounds.min.x; vx *= bounce; }
+        if (x > Bounds.max.x) { x = Bounds.max.x; vx *= bounce; }
+        if (y < Bounds.min.y) { y = Bounds.min.y; vy *= bounce; }
+        if (y > Bounds.max.y) { y = Bounds.max.y; vy *= bounce; }
+
+        p.positionX[i] = x;
+        p.positionY[i] = y;
+        p.velocityX[i] = vx;
+        p.velocityY[i] = vy;
+    }
+}
+
+// ------------------ Coupling ------------------
+// Bodies are solid convex polygons for the particles: a particle inside is pushed out
+// through the closest edge and loses its approaching velocity. In TwoWay mode the
+// removed momentum goes to the dynamic body.
+void PhysicsWorld::FluidSystem::CoupleBodies()
+{
+    FluidStore& p = Particles;
+    const float radius = 0.25f * SmoothingRadius;
+    const float invCell = 1.0f / SmoothingRadius;
+
+    for (Collision2D* col : world.Collisions.SpatialGrid.Objects) {
+        if (!col->PHYSICS_PARENT) continue;
+
+        RigidBody2D* body = RigidBody2D::FromCollision(col);
+        if (body && (body->IsStatic() || body->IsSleeping())) body = nullptr;
+        const bool reaction = body && Coupling == FluidCoupling::TwoWay;
+
+        std::span<const glm::vec2> vertices = col->getVertices(world.Arena);
+        const size_t count = vertices.size();
+        if (count < 3) continue;
+
+        // Outward edge normals, whatever the winding
+        float area = 0.0f;
+        for (size_t e = 0; e < count; e++) area += cross(vertices[e], vertices[(e + 1) % count]);
+        const float side = area > 0.0f ? 1.0f : -1.0f;
+
+        std::span<glm::vec2> normals = world.Arena.Allocate<glm::vec2>(count);
+        glm::vec2 min = vertices[0], max = vertices[0];
+        for (size_t e = 0; e < count; e++) {
+            glm::vec2 edge = vertices[(e + 1) % count] - vertices[e];
+            normals[e] = side * glm::normalize(glm::vec2(edge.y, -edge.x));
+            min = glm::min(min, vertices[e]);
+            max = glm::max(max, vertices[e]);
+        }
+        min -= glm::vec2(radius);
+        max += glm::vec2(radius);
+
+        const int x0 = CellCoord(min.x, Bounds.min.x, invCell, GridWidth);
+        const int x1 = CellCoord(max.x, Bounds.min.x, invCell, GridWidth);
+        const int y0 = CellCoord(min.y, Bounds.min.y, invCell, GridHeight);
+        const int y1 = CellCoord(max.y, Bounds.min.y, invCell, GridHeight);
+
+        for (int cy = y0; cy <= y1; cy++) {
+            const size_t row = size_t(cy) * GridWidth;
+            for (uint32_t i = CellStart[row + x0]; i < CellStart[row + x1 + 1]; i++) {
+                glm::vec2 point(p.positionX[i], p.positionY[i]);
+
+                // Separating edge with the least penetration
+                float distance = std::numeric_limits<float>::lowest();
+                size_t closest = 0;
+                for (size_t e = 0; e < count; e++) {
+                    float d = glm::dot(point - vertices[e], normals[e]);
+                    if (d > distance) { distance = d; closest = e; }
+                }
+                if (distance >= radius) continue;
+
+                const glm::vec2 n = normals[closest];
+                point += n * (radius - distance);
+
+                glm::vec2 velocity(p.velocityX[i], p.velocityY[i]);
+                glm::vec2 surface(0.0f);
+                glm::vec2 arm(0.0f);
+                if (body) {
+                    arm = point - body->getPosition();
+                    surface = body->getLinearVelocity() + body->getAngularVelocity() * perp(arm);
+                }
+
+                float vn = glm::dot(velocity - surface, n);
+                if (vn < 0.0f) {
+                    velocity -= vn * n;
+                    if (reaction) body->ApplyImpulse(ParticleMass * vn * n, arm);
+                }
+
+                p.positionX[i] = point.x;
+                p.positionY[i] = point.y;
+                p.velocityX[i] = velocity.x;
+                p.velocityY[i] = velocity.y;
+            }
+        }
+    }
+}
+
+// ------------------- Render -------------------
+void PhysicsWorld::FluidSystem::Render()
+{
+    const size_t count = Particles.Size();
+    if (count == 0) return;
+
+    std::vector<glm::vec2> points(count);
+    for (size_t i = 0; i < count; i++) points[i] = {Particles.positionX[i], Particles.positionY[i]};
+    Renderer2D::DrawPoints(points, {0.2f, 0.5f, 1.0f, 1.0f}, 3.0f);
+}
@@ -0,0 +1,163 @@
+#include "PhysicsWorld.hpp"
+#include <Engine/Servers/JobServer/JobServer.hpp>
+
+/*
+Barnes-Hut:
+    build a quadtree over the body positions, every cell keeps its total mass and center of mass
+    for each body, walk the tree: a cell seen under an angle (size / distance) below Theta
+    acts as a single point mass, otherwise open it (leaves are summed body by body)
+    F = G * m * M * d / (|d|² + ε²)^(3/2)
+Forces go through ApplyForce, the tree walk runs on the JobServer (every body writes only to itself).
+*/
+
+static constexpr uint32_t LeafSize = 8;
+static constexpr int MaxDepth = 24;     // coincident bodies end up sharing a leaf
+
+void PhysicsWorld::GravitySystem::Apply()
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    if (store.Size() < 2) return;
+
+    store.Gather();
+    Build();
+    if (Tree.empty()) return;
+
+    // Walk in leaf order: neighbouring bodies open the same cells
+    JobServer::ParallelFor(Points.size(), 256, [this, &store](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            RigidBody2D* body = store.owners[Points[i].body];
+            if (body->IsStatic() || body->IsSleeping()) continue;
+            body->ApplyForce(Accumulate(Points[i].body));
+        }
+    });
+}
+
+// -------------------- Build -------------------
+void PhysicsWorld::GravitySystem::Build()
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    Points.clear();
+    Tree.clear();
+
+    float minX = std::numeric_limits<float>::max(), minY = minX;
+    float maxX = std::numeric_limits<float>::lowest(), maxY = maxX;
+    for (size_t i = 0; i < store.Size(); i++) {
+        if (store.mass[i] <= 0.0f) continue;
+        Points.push_back({store.positionX[i], store.positionY[i], store.mass[i], static_cast<uint32_t>(i)});
+        minX = std::min(minX, store.positionX[i]);
+        minY = std::min(minY, store.positionY[i]);
+        maxX = std::max(maxX, store.positionX[i]);
+        maxY = std::max(maxY, store.positionY[i]);
+    }
+    if (Points.empty()) return;
+
+    Node root;
+    root.centerX = 0.5f * (minX + maxX);
+    root.centerY = 0.5f * (minY + maxY);
+    root.half = 0.5f * std::max(maxX - minX, maxY - minY) + 1.0f;
+    root.count = static_cast<uint32_t>(Points.size());
+    Tree.reserve(Points.size() / 2 + 1);
+    Tree.push_back(root);
+    Split(0, 0);
+}
+
+// Computes the cell mass, then partitions its points into 4 quadrants (depth first, so subtrees stay contiguous)
+void PhysicsWorld::GravitySystem::Split(int node, int depth)
+{
+    const uint32_t first = Tree[node].first;
+    const uint32_t count = Tree[node].count;
+
+    float mass = 0.0f, comX = 0.0f, comY = 0.0f;
+    for (uint32_t i = first; i < first + count; i++) {
+        mass += Points[i].mass;
+        comX += Points[i].mass * Points[i].x;
+        comY += Points[i].mass * Points[i].y;
+    }
+    Tree[node].mass = mass;
+    Tree[node].comX = comX / mass;
+    Tree[node].comY = comY / mass;
+
+    if (count <= LeafSize || depth >= MaxDepth) return;
+
+    const float cx = Tree[node].centerX;
+    const float cy = Tree[node].centerY;
+
+    // Partition: x halves first, then y inside each half
+    auto begin = Points.begin() + first;
+    auto end = begin + count;
+    auto midX = std::partition(begin, end, [cx](const Point& p) { return p.x < cx; });
+    auto low = std::partition(begin, midX, [cy](const Point& p) { return p.y < cy; });
+    auto high = std::partition(midX, end, [cy](const Point& p) { return p.y < cy; });
+
+    // Quadrant order: 0 = (-x,-y), 1 = (+x,-y), 2 = (-x,+y), 3 = (+x,+y)
+    const uint32_t bounds[4][2] = {
+        {first, static_cast<uint32_t>(low - Points.begin())},
+        {static_cast<uint32_t>(midX - Points.begin()), static_cast<uint32_t>(high - Points.begin())},
+        {static_cast<uint32_t>(low - Points.begin()), static_cast<uint32_t>(midX - Points.begin())},
+        {static_cast<uint32_t>(high - Points.begin()), first + count},
+    };
+
+    const int children = static_cast<int>(Tree.size());
+    const float half = 0.5f * Tree[node].half;
+    Tree[node].firstChild = children;
+    for (int q = 0; q < 4; q++) {
+        Node child;
+        child.half = half;
+        child.centerX = cx + ((q & 1) ? half : -half);
+        child.centerY = cy + ((q & 2) ? half : -half);
+        child.first = bounds[q][0];
+        child.count = bounds[q][1] - bounds[q][0];
+        Tree.push_back(child);
+    }
+
+    for (int q = 0; q < 4; q++)
+        if (Tree[children + q].count > 0) Split(children + q, depth + 1);
+}
+
+// ------------------- Forces -------------------
+glm::vec2 PhysicsWorld::GravitySystem::Accumulate(uint32_t body) const
+{
+    const RigidBodyStore& store = world.RigidBodies.Store;
+    const float x = store.positionX[body];
+    const float y = store.positionY[body];
+    const float theta2 = Theta * Theta;
+    const float eps2 = Softening * Softening;
+
+    // a += M * d / (|d|² + ε²)^(3/2)
+    float ax = 0.0f, ay = 0.0f;
+    auto attract = [&](float px, float py, float mass) {
+        const float dx = px - x;
+        const float dy = py - y;
+        const float inv = 1.0f / std::sqrt(dx * dx + dy * dy + eps2);
+        const float s = mass * inv * inv * inv;
+        ax += dx * s;
+        ay += dy * s;
+    };
+
+    int stack[3 * MaxDepth + 8];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& n = Tree[stack[--top]];
+        if (n.count == 0) continue;
+
+        const float dx = n.comX - x;
+        const float dy = n.comY - y;
+        const float size = 2.0f * n.half;
+
+        if (size * size < theta2 * (dx * dx + dy * dy)) {
+            attract(n.comX, n.comY, n.mass);
+        }
+        else if (n.firstChild < 0) {
+            for (uint32_t i = n.first; i < n.first + n.count; i++)
+                if (Points[i].body != body) attract(Points[i].x, Points[i].y, Points[i].mass);
+        }
+        else {
+            for (int q = 0; q < 4; q++) stack[top++] = n.firstChild + q;
+        }
+    }
+
+    // F = m * a
+    return Constant * store.mass[body] * glm::vec2(ax, ay);
+}
@@ -0,0 +1,99 @@
+#include "PhysicsWorld.hpp"
+
+/*
+Every body takes the level of its region (RegionSize square cells), picked from the distance
+between the region center and the closest focus point:
+    Full     < ReducedDistance
+    Reduced  < FrozenDistance
+    Frozen   beyond
+A region only moves to a farther level once past threshold + Hysteresis, and back to a closer
+one once under threshold - Hysteresis.
+Reduced regions are staggered over ReducedRate frames (phase from the region coordinates)
+so they don't all catch up on the same frame. Frozen regions drop their time.
+A body that is not stepped this frame is static to the solvers: a full body resting on it takes
+the whole response, and it gains no velocity while it waits.
+*/
+
+static int RegionPhase(int x, int y, int rate) {
+    uint32_t hash = uint32_t(x) * 73856093u ^ uint32_t(y) * 19349663u;
+    return int(hash % uint32_t(rate));
+}
+
+void PhysicsWorld::LODSystem::Update(float delta)
+{
+    if (!Enabled || FocusPoints.empty() || delta <= 0.0f) {
+        if (Applied) Reset();
+        return;
+    }
+    Applied = true;
+    Frame++;
+
+    RigidBodyStore& store = world.RigidBodies.Store;
+    const int rate = std::max(ReducedRate, 1);
+    const float invRegion = 1.0f / RegionSize;
+
+    for (size_t i = 0; i < store.Size(); i++) {
+        const glm::vec2 position = store.transforms[i]->position;
+        const int rx = int(std::floor(position.x * invRegion));
+        const int ry = int(std::floor(position.y * invRegion));
+        const glm::vec2 center = (glm::vec2(float(rx), float(ry)) + 0.5f) * RegionSize;
+
+        float distance2 = std::numeric_limits<float>::max();
+        for (const glm::vec2& focus : FocusPoints)
+            distance2 = std::min(distance2, glm::length2(center - focus));
+        const float distance = std::sqrt(distance2);
+
+        // Hysteresis: farther only past the upper band, closer only under the lower band
+        const uint8_t farther = distance > FrozenDistance + Hysteresis ? 2 : distance > ReducedDistance + Hysteresis ? 1 : 0;
+        const uint8_t closer = distance < ReducedDistance - Hysteresis ? 0 : distance < FrozenDistance - Hysteresis ? 1 : 2;
+        uint8_t level = store.lod[i];
+        if (farther > level) level = farther;
+        else if (closer < level) level = closer;
+        store.lod[i] = level;
+
+        store.lodTime[i] += delta;
+        bool stepping = false;
+        switch (SimulationLOD(level)) {
+            case SimulationLOD::Full:    stepping = true; break;
+            case SimulationLOD::Reduced: stepping = (int(Frame % uint32_t(rate)) == RegionPhase(rx, ry, rate)); break;
+            case SimulationLOD::Frozen:  store.lodTime[i] = 0.0f; break;
+        }
+
+        if (stepping) {
+            store.timeScale[i] = store.lodTime[i] / delta;
+            store.lodTime[i] = 0.0f;
+        }
+        else store.timeScale[i] = 0.0f;
+    }
+}
+
+void PhysicsWorld::LODSystem::Reset()
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    for (size_t i = 0; i < store.Size(); i++) {
+        store.lod[i] = uint8_t(SimulationLOD::Full);
+        store.timeScale[i] = 1.0f;
+        store.lodTime[i] = 0.0f;
+    }
+    Applied = false;
+}
+
+SimulationLOD PhysicsWorld::LODSystem::Level(const RigidBody2D* body) const
+{
+    return SimulationLOD(world.RigidBodies.Store.lod[body->getStoreIndex()]);
+}
+
+bool PhysicsWorld::LODSystem::Idle(const RigidBody2D* body) const
+{
+    if (!Applied || !body) return false;
+    const RigidBodyStore& store = world.RigidBodies.Store;
+    const uint32_t id = body->getStoreIndex();
+    return store.lod[id] != uint8_t(SimulationLOD::Full) && store.timeScale[id] == 0.0f;
+}
+
+bool PhysicsWorld::LODSystem::SkipsPair(const Collision2D* a, const Collision2D* b) const
+{
+    const RigidBody2D* bodyA = RigidBody2D::FromCollision(a);
+    const RigidBody2D* bodyB = RigidBody2D::FromCollision(b);
+    return Idle(bodyA) && Idle(bodyB);
+}
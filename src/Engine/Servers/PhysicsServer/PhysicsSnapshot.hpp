@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+class PhysicsWorld;
+
+// Pointer free copy of the whole physics state in one contiguous buffer
+// (see PhysicsWorld::SnapshotSystem). Capturing again into the same snapshot
+// reuses its memory, so a warmed up ring never allocates.
+struct PhysicsSnapshot {
+    uint32_t frame = 0;
+    uint32_t bodyCount = 0;
+    uint32_t jointCounts[5] = {};
+    uint32_t particleCount = 0;
+    uint32_t contactCount = 0;      // touching pairs of ContactSystem
+    uint32_t layout = 0;            // RigidBodyStore::Layout() at capture
+    std::vector<std::byte> data;
+};
+
+// Fixed number of slots indexed by frame % slots (rollback window) over one world, at least one slot
+class SnapshotRing {
+public:
+    explicit SnapshotRing(PhysicsWorld& world, size_t slots = 16)
+        : World(&world), Slots(std::max<size_t>(slots, 1)), Valid(std::max<size_t>(slots, 1), false) {}
+
+    void Save(uint32_t frame);
+    bool Restore(uint32_t frame);
+    bool Has(uint32_t frame) const {
+        const size_t slot = frame % Slots.size();
+        return Valid[slot] && Slots[slot].frame == frame;
+    }
+    void Clear() { std::fill(Valid.begin(), Valid.end(), false); }
+
+private:
+    PhysicsWorld* World;
+    std::vector<PhysicsSnapshot> Slots;
+    std::vector<bool> Valid;
+};
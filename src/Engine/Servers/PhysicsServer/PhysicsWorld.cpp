@@ -0,0 +1,455 @@
+#include "PhysicsWorld.hpp"
+#include <chrono>
+
+/* World */
+PhysicsWorld::PhysicsWorld(const AABB& bounds)
+:
+    Collisions(*this, bounds),
+    RigidBodies(*this),
+    Joints(*this),
+    Determinism(*this),
+    Snapshots(*this),
+    LOD(*this),
+    MutualGravity(*this),
+    Fluid(*this),
+    Reorder(*this),
+    Contacts(*this),
+    XPBD(*this)
+{}
+
+PhysicsWorld::~PhysicsWorld()
+{
+    Clear();
+}
+
+Collision2D* PhysicsWorld::CreateCollision(const Shape2D* shape, glm::vec4 color, glm::vec4 outline_color, glm::vec4 colliding_color)
+{
+    return new Collision2D(*this, shape, color, outline_color, colliding_color);
+}
+
+void PhysicsWorld::Clear()
+{
+    // Joints, particles and transform links only reference bodies, drop them first
+    Joints.Clear();
+    Fluid.Particles.Clear();
+    Hierarchy.Clear();
+
+    // A body owns its collider: deleting the body removes both from the world
+    while (!Collisions.SpatialGrid.Objects.empty()) {
+        Collision2D* col = Collisions.SpatialGrid.Objects.back();
+        if (col->PHYSICS_PARENT) delete col->PHYSICS_PARENT;
+        else delete col;
+    }
+    // Bodies built without a collider
+    while (RigidBodies.Store.Size() > 0) delete RigidBodies.Store.owners.back();
+
+    LOD.Reset();
+    Reorder.Frame = 0;
+    Contacts.Reset();
+    Determinism.History.clear();
+}
+
+// Capacity for `needed` elements, at least doubling so repeated small batches stay amortized O(1)
+template <typename Grow>
+static void ReserveFor(size_t needed, size_t capacity, Grow grow) {
+    if (needed > capacity) grow(std::max(needed, 2 * capacity));
+}
+
+void PhysicsWorld::SpawnBodies(std::span<const BodyDesc2D> bodies, std::span<Handle<RigidBody2D>> handles)
+{
+    RigidBodyStore& store = RigidBodies.Store;
+    std::vector<Collision2D*>& objects = Collisions.SpatialGrid.Objects;
+    ReserveFor(store.Size() + bodies.size(), store.Capacity(), [&](size_t count) { store.Reserve(count); });
+    ReserveFor(objects.size() + bodies.size(), objects.capacity(), [&](size_t count) { objects.reserve(count); });
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const BodyDesc2D& desc = bodies[i];
+        RigidBody2D* body = new RigidBody2D(
+            new Collision2D(*this, desc.shape, desc.color, desc.outlineColor, desc.collidingColor),
+            desc.mass, desc.restitution, desc.friction, desc.gravityScale,
+            desc.linearDamping, desc.angularDamping, desc.canSleep, false, desc.isStatic);
+
+        body->collision->filter = desc.filter;
+        body->setPosition(desc.position);
+        body->setRotation(desc.rotation);
+        body->setLinearVelocity(desc.linearVelocity);
+        body->setAngularVelocity(desc.angularVelocity);
+        if (desc.scale != glm::vec2(1.0f)) {
+            body->transform->scale = desc.scale;
+            body->CalculateInertia();
+        }
+        if (i < handles.size()) handles[i] = body->GetHandle();
+    }
+}
+
+void PhysicsWorld::DestroyBodies(std::span<const Handle<RigidBody2D>> handles)
+{
+    // The body takes its collider with it: both leave the store / grid by swap-and-pop
+    for (Handle<RigidBody2D> handle : handles) delete RigidBody2D::Resolve(handle);
+}
+
+void PhysicsWorld::Update(float delta)
+{
+    const auto start = std::chrono::steady_clock::now();
+    Arena.Reset();
+    Joints.Prune();
+    if (Hierarchy.Update()) RigidBodies.Store.SyncAttached();     // bodies attached since the last step turn static first
+    Reorder.Update();
+    LOD.Update(delta);
+    if (MutualGravity.Enabled) MutualGravity.Apply();
+
+    if (Mode == SolverMode::XPBD) {
+        // Substeps run their own broadphase
+        XPBD.Step(delta);
+        Fluid.Step(delta);
+    }
+    else {
+        Collisions.Detect();
+        RigidBodies.Step(delta);
+        if (Contacts.Enabled) Contacts.Record();
+        Fluid.Step(delta);
+    }
+
+    // Attached parts follow the bodies just integrated
+    Hierarchy.Update();
+    if (Hierarchy.Updated) RigidBodies.Store.GatherAttached();
+    if (Contacts.Enabled) Contacts.Publish();
+    if (Determinism.Enabled) Determinism.Record();
+    Stats.stepMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void PhysicsWorld::Render() {
+    Collisions.SpatialGrid.Render();
+    Fluid.Render();
+}
+
+/* Collision System */
+
+void PhysicsWorld::CollisionSystem::Detect()
+{
+    if (world.Hierarchy.Update()) world.RigidBodies.Store.SyncAttached();
+    SpatialGrid.Update(world.Arena);
+
+    for (auto* obj : SpatialGrid.Objects) {
+        obj->info = Collision2DInfos();
+    }
+
+    std::span<std::pair<Collision2D*, Collision2D*>> pairs = SpatialGrid.CollectPhyisicsPair(world.Arena);
+
+    // Grouped by first collider, so each collider's infos are one slice of the arrays below.
+    // The grid hands pairs out in sorted (cell, object slot) order, and slots shift as colliders come and go:
+    // deterministic mode sorts by creation id so every run solves in the same order, otherwise by address.
+    if (world.Determinism.Enabled) {
+        std::sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) {
+            if (a.first->id != b.first->id) return a.first->id < b.first->id;
+            return a.second->id < b.second->id;
+        });
+    }
+    else {
+        std::sort(pairs.begin(), pairs.end());
+    }
+
+    std::span<Collision2D*> colliders = world.Arena.Allocate<Collision2D*>(pairs.size());
+    std::span<Collision2D*> physicsColliders = world.Arena.Allocate<Collision2D*>(pairs.size());
+    std::span<glm::vec2> mtvs = world.Arena.Allocate<glm::vec2>(pairs.size());
+    std::span<std::span<const glm::vec2>> contacts = world.Arena.Allocate<std::span<const glm::vec2>>(pairs.size());
+    std::span<float> impulses = world.Arena.Allocate<float>(pairs.size());
+    size_t count = 0, physicsCount = 0;
+
+    for (size_t begin = 0, end = 0; begin < pairs.size(); begin = end) {
+        Collision2D* obj = pairs[begin].first;
+        const size_t first = count, physicsFirst = physicsCount;
+
+        for (end = begin; end < pairs.size() && pairs[end].first == obj; end++) {
+            Collision2D* other = pairs[end].second;
+            if (other == obj) continue;
+            if (world.LOD.Enabled && world.LOD.SkipsPair(obj, other)) continue;
+
+            CollisionResult2D result = CDA::Detect(obj, other, world.Arena);
+            if (!result.isColliding) continue;
+
+            colliders[count++] = other;
+            if (other->PHYSICS_PARENT) {
+                physicsColliders[physicsCount] = other;
+                mtvs[physicsCount] = result.MTV;
+                std::construct_at(&contacts[physicsCount], result.ContactPoints);
+                impulses[physicsCount] = 0.0f;
+                physicsCount++;
+            }
+            if (result.isPhysicsColliding) obj->info.isPhysicsColliding = true;
+        }
+
+        obj->info.isColliding = count > first;
+        obj->info.Colliders = colliders.subspan(first, count - first);
+        obj->info.PhysicsColliders = physicsColliders.subspan(physicsFirst, physicsCount - physicsFirst);
+        obj->info.MTV = mtvs.subspan(physicsFirst, physicsCount - physicsFirst);
+        obj->info.ContactPoints = contacts.subspan(physicsFirst, physicsCount - physicsFirst);
+        obj->info.Impulse = impulses.subspan(physicsFirst, physicsCount - physicsFirst);
+    }
+}
+
+/* RigidBody System */
+
+void PhysicsWorld::RigidBodySystem::Step(float delta)
+{
+    Store.Gather();
+    Store.IntegrateForces(delta, world.Gravity * world.GravityDirection);
+
+    SolverStats& Stats = world.Stats;
+    Stats = SolverStats();
+    for (size_t i = 0; i < Store.Size(); i++) {
+        RigidBody2D* body = Store.owners[i];
+        if (!body->collision || !body->collision->info.isPhysicsColliding) continue;
+        for (glm::vec2 mtv : body->collision->info.MTV)
+            Stats.maxPenetration = std::max(Stats.maxPenetration, glm::length(mtv));
+    }
+
+    // Contacts and joints share the same velocity iterations.
+    // Calm steps stop as soon as the residual is under tolerance, deep penetrations run to the cap.
+    const bool deep = Stats.maxPenetration > world.PenetrationTolerance;
+    world.Joints.Prepare(delta);
+    world.Joints.PrepareDirect();
+    for (int iteration = 0; iteration < world.SolverIterations; iteration++) {
+        Residual = 0.0f;
+        for (size_t i = 0; i < Store.Size(); i++) {
+            RigidBody2D* body = Store.owners[i];
+            if (body->collision && body->collision->info.isPhysicsColliding)
+                Solve(body, body->collision->info);
+        }
+        Residual = std::max(Residual, world.Joints.Solve());
+        world.Joints.SolveDirect();
+
+        Stats.iterations = iteration + 1;
+        Stats.residual = Residual;
+        if (!deep && Stats.iterations >= world.MinSolverIterations && Residual <= world.SolverTolerance) break;
+    }
+
+    for (size_t i = 0; i < Store.Size(); i++) {
+        RigidBody2D* body = Store.owners[i];
+        if (body->collision && body->collision->info.isPhysicsColliding)
+            SolvePositions(body, body->collision->info);
+    }
+
+    Store.IntegrateVelocities(delta);
+    Store.Scatter();
+}
+
+void PhysicsWorld::RigidBodySystem::Solve(RigidBody2D* obj, const Collision2DInfos& info)
+{
+    if (!obj || obj->IsStatic() || !info.isPhysicsColliding) return;
+    const bool idle = world.LOD.Idle(obj);      // held still by LOD: static this step
+
+    for (Collision2D* otherCol : info.PhysicsColliders)
+    {
+        RigidBody2D* other = RigidBody2D::FromCollision(otherCol);
+
+        if (other) {
+            if (!other->IsStatic())
+                SolveToDynamicBody(obj, other, info);
+            else if (!idle)
+                SolveToStaticBody(obj, other, info);
+        } 
+        else if (!idle) {
+            SolveToStaticBody(obj, PhysicsBody2D::FromCollision(otherCol), info);
+        }
+    }
+}
+
+void PhysicsWorld::RigidBodySystem::SolvePositions(RigidBody2D* obj, const Collision2DInfos& info)
+{
+    if (!obj || obj->IsStatic() || !info.isPhysicsColliding) return;
+    const bool idle = world.LOD.Idle(obj);
+
+    for (Collision2D* otherCol : info.PhysicsColliders)
+    {
+        RigidBody2D* other = RigidBody2D::FromCollision(otherCol);
+
+        if (other && !other->IsStatic())
+            CorrectToDynamicBody(obj, other, info);
+        else if (!idle)
+            CorrectToStaticBody(obj, PhysicsBody2D::FromCollision(otherCol), info);
+    }
+}
+
+// ---------------- Solve Static ----------------
+void PhysicsWorld::RigidBodySystem::SolveToStaticBody(RigidBody2D* obj, PhysicsBody2D* other, const Collision2DInfos& info)
+{
+    int slot = info.Find(other->collision);
+    if (slot < 0) return;
+    std::span<const glm::vec2> contacts = info.ContactPoints[slot];
+    glm::vec2 mtv = info.MTV[slot];
+
+    if (glm::length2(mtv) < 1e-8f) return;
+    
+    glm::vec2 normal = glm::normalize(mtv);
+
+    for (const auto& globalContact : contacts) 
+    {
+        glm::vec2 contact = globalContact - obj->getPosition();
+        glm::vec2 rPerp = glm::vec2(-contact.y, contact.x);
+        glm::vec2 pointVel = obj->getLinearVelocity() + obj->getAngularVelocity() * rPerp;
+        
+        float velAlongNormal = glm::dot(pointVel, normal);
+        if (velAlongNormal > -1e-4f) continue;
+        Residual = std::max(Residual, -velAlongNormal);
+
+        float rCrossN = glm::cross(glm::vec3(contact, 0.0f), glm::vec3(normal, 0.0f)).z;
+        float effectiveMass = 1.0f / (obj->getInverseMass() + (rCrossN * rCrossN) * obj->getInverseInertia());
+
+        // Restitution
+
+        float e = obj->getRestitution();
+        if (std::abs(velAlongNormal) < 1.0f)
+            e = std::lerp(0.0f, e, std::abs(velAlongNormal));
+
+        float j = -(1.0f + e) * velAlongNormal * effectiveMass;
+        obj->ApplyImpulse(j * normal, contact);
+        info.Impulse[slot] += j;
+
+        // Friction
+        glm::vec2 tangentVel = pointVel - normal * velAlongNormal;
+        if (glm::length2(tangentVel) > 1e-8f) 
+        {
+            glm::vec2 tangent = glm::normalize(tangentVel);
+            float rCrossT = glm::cross(glm::vec3(contact, 0.0f), glm::vec3(tangent, 0.0f)).z;
+            float tangentEffectiveMass = 1.0f / (obj->getInverseMass() + (rCrossT * rCrossT) * obj->getInverseInertia());
+            float jt = -glm::dot(pointVel, tangent) * tangentEffectiveMass;
+
+            float maxFriction = j * obj->getFriction();
+            jt = glm::clamp(jt, -maxFriction, maxFriction);
+
+            obj->ApplyImpulse(jt * tangent, contact);
+        }
+    }
+}
+
+// --------------- Solve Dynamic ----------------
+void PhysicsWorld::RigidBodySystem::SolveToDynamicBody(RigidBody2D* obj, RigidBody2D* other, const Collision2DInfos& info)
+{
+    int slot = info.Find(other->collision);
+    if (slot < 0) return;
+    std::span<const glm::vec2> contacts = info.ContactPoints[slot];
+    glm::vec2 mtv = info.MTV[slot];
+
+    if (glm::length2(mtv) < 1e-8f) return;
+
+    // A body held still by LOD acts as static: no inverse mass, no impulses
+    const bool movesA = !world.LOD.Idle(obj), movesB = !world.LOD.Idle(other);
+    if (!movesA && !movesB) return;
+    const float invMassA = movesA ? obj->getInverseMass() : 0.0f;
+    const float invInertiaA = movesA ? obj->getInverseInertia() : 0.0f;
+    const float invMassB = movesB ? other->getInverseMass() : 0.0f;
+    const float invInertiaB = movesB ? other->getInverseInertia() : 0.0f;
+    
+    glm::vec2 normal = glm::normalize(mtv);
+
+    for (const auto& globalContact : contacts) 
+    {
+        glm::vec2 contactA = globalContact - obj->getPosition();
+        glm::vec2 contactB = globalContact - other->getPosition();
+
+        glm::vec2 rPerpA = glm::vec2(-contactA.y, contactA.x);
+        glm::vec2 rPerpB = glm::vec2(-contactB.y, contactB.x);
+        
+        glm::vec2 velA = obj->getLinearVelocity() + obj->getAngularVelocity() * rPerpA;
+        glm::vec2 velB = other->getLinearVelocity() + other->getAngularVelocity() * rPerpB;
+        glm::vec2 relVel = velA - velB;
+
+        float velAlongNormal = glm::dot(relVel, normal);
+        if (velAlongNormal > -1e-4f) continue;
+        Residual = std::max(Residual, -velAlongNormal);
+
+        // Restitution
+
+        float e = std::min(obj->getRestitution(), other->getRestitution());
+        if (std::abs(velAlongNormal) < 1.0f)
+            e = std::lerp(0.0f, e, std::abs(velAlongNormal));
+
+        float rCrossNA = glm::cross(glm::vec3(contactA, 0.0f), glm::vec3(normal, 0.0f)).z;
+        float rCrossNB = glm::cross(glm::vec3(contactB, 0.0f), glm::vec3(normal, 0.0f)).z;
+        
+        float effectiveMass = 1.0f / (
+            invMassA + 
+            invMassB +
+            (rCrossNA * rCrossNA) * invInertiaA +
+            (rCrossNB * rCrossNB) * invInertiaB
+        );
+
+        float j = -(1.0f + e) * velAlongNormal * effectiveMass;
+        glm::vec2 impulse = j * normal;
+        if (movesB && other->IsSleeping()) other->WakeUp();
+        if (movesA) obj->ApplyImpulse( impulse, contactA);
+        if (movesB) other->ApplyImpulse(-impulse, contactB);
+        info.Impulse[slot] += j;
+
+        // Friction
+        glm::vec2 tangentVel = relVel - normal * velAlongNormal;
+        if (glm::length2(tangentVel) > 1e-8f) 
+        {
+            glm::vec2 tangent = glm::normalize(tangentVel);
+
+            float rCrossTA = glm::cross(glm::vec3(contactA,0.0f), glm::vec3(tangent,0.0f)).z;
+            float rCrossTB = glm::cross(glm::vec3(contactB,0.0f), glm::vec3(tangent,0.0f)).z;
+
+            float tangentEffectiveMass = 1.0f / (
+                invMassA + 
+                invMassB +
+                (rCrossTA*rCrossTA) * invInertiaA +
+                (rCrossTB*rCrossTB) * invInertiaB
+            );
+
+            float jt = -glm::dot(relVel, tangent) * tangentEffectiveMass;
+            float mu = std::sqrt(obj->getFriction() * other->getFriction());
+            jt = glm::clamp(jt, -jt*mu, jt*mu);
+
+            glm::vec2 frictionImpulse = jt * tangent;
+            if (movesA) obj->ApplyImpulse( frictionImpulse, contactA);
+            if (movesB) other->ApplyImpulse(-frictionImpulse, contactB);
+        }
+    }
+}
+
+// ------------- Positional Correction ----------
+void PhysicsWorld::RigidBodySystem::CorrectToStaticBody(RigidBody2D* obj, PhysicsBody2D* other, const Collision2DInfos& info)
+{
+    int slot = info.Find(other->collision);
+    if (slot < 0) return;
+    glm::vec2 mtv = info.MTV[slot];
+    if (glm::length2(mtv) < 1e-8f) return;
+
+    float penetration = glm::length(mtv);
+    glm::vec2 normal = mtv / penetration;
+
+    const float beta = 0.2f;
+    const float slop = 0.001f;
+    float correctionMagnitude = beta * std::max(penetration - slop, 0.0f);
+    obj->setPosition(obj->getPosition() + normal * correctionMagnitude);
+}
+
+void PhysicsWorld::RigidBodySystem::CorrectToDynamicBody(RigidBody2D* obj, RigidBody2D* other, const Collision2DInfos& info)
+{
+    int slot = info.Find(other->collision);
+    if (slot < 0) return;
+    glm::vec2 mtv = info.MTV[slot];
+    if (glm::length2(mtv) < 1e-8f) return;
+
+    float penetration = glm::length(mtv);
+    glm::vec2 normal = mtv / penetration;
+
+    const float beta = 0.2f;
+    const float slop = 0.001f;
+    float correctionMagnitude = beta * std::max(penetration - slop, 0.0f);
+    glm::vec2 correction = normal * correctionMagnitude;
+
+    float totalMass = obj->getMass() + other->getMass();
+    float ratioA = other->getMass() / totalMass;
+    float ratioB = obj->getMass() / totalMass;
+
+    // A body held still by LOD does not move, the other one takes the whole correction
+    const bool movesA = !world.LOD.Idle(obj), movesB = !world.LOD.Idle(other);
+    if (!movesA) { ratioA = 0.0f; ratioB = movesB ? 1.0f : 0.0f; }
+    else if (!movesB) { ratioA = 1.0f; ratioB = 0.0f; }
+
+    obj->setPosition(obj->getPosition() + correction * ratioA);
+    other->setPosition(other->getPosition() - correction * ratioB);
+}
@@ -0,0 +1,426 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <span>
+#include <Math/Math.hpp>
+#include <Engine/Object/2D/Collision2D.hpp>
+#include <Engine/Component/TransformHierarchy.hpp>
+#include <Engine/Object/2D/PhysicsBody2D/RigidBody2D.hpp>
+#include "Algorithms/CollisionDetectionAlgorithm.hpp"
+#include "CollisionSpatialGrid.hpp"
+#include "RigidBodyStore.hpp"
+#include "FluidStore.hpp"
+#include "PhysicsSnapshot.hpp"
+#include "Constraints/Joint2D.hpp"
+
+enum class FluidCoupling {
+    None,       // fluid ignores bodies
+    OneWay,     // bodies push the fluid
+    TwoWay      // ... and the fluid pushes dynamic bodies back
+};
+
+enum class SimulationLOD : uint8_t {
+    Full,       // stepped every frame
+    Reduced,    // stepped every LODSystem::ReducedRate frames with the accumulated dt
+    Frozen      // not stepped
+};
+
+enum class SolverMode {
+    SequentialImpulse,  // iterated velocity solver (contacts + joints)
+    XPBD                // substepped position based dynamics
+};
+
+// Per-step solver telemetry (see PhysicsWorld::Stats)
+struct SolverStats {
+    int iterations = 0;             // velocity iterations run (XPBD: substeps)
+    float residual = 0.0f;          // worst velocity error of the last iteration (px/s, rad/s for angular rows)
+    float maxPenetration = 0.0f;    // deepest contact this step, from the collision MTVs
+    float stepMs = 0.0f;            // wall time of the whole Update()
+};
+
+enum class ContactPhase2D : uint8_t {
+    Begin,      // first step the pair touches
+    Persist,    // still touching
+    End         // touched last step, not anymore
+};
+
+// One touching collider pair, see PhysicsWorld::ContactSystem
+struct ContactEvent2D {
+    ContactPhase2D phase;
+    Collision2D* a = nullptr;       // lower creation id; null in End events once the collider is destroyed
+    Collision2D* b = nullptr;
+    glm::vec2 normal{0.0f};         // pushes A out of B
+    glm::vec2 point{0.0f};          // mean contact point
+    float impulse = 0.0f;           // normal impulse the solver applied this step (End events: all zero)
+};
+
+// One body for PhysicsWorld::SpawnBodies (defaults match the RigidBody2D / Collision2D constructors)
+struct BodyDesc2D {
+    const Shape2D* shape = nullptr;     // shared, see ShapeLibrary
+    glm::vec2 position{0.0f};
+    float rotation = 0.0f;              // degrees
+    glm::vec2 scale{1.0f};
+    glm::vec2 linearVelocity{0.0f};
+    float angularVelocity = 0.0f;
+
+    float mass = 1.0f;
+    float restitution = 0.2f;
+    float friction = 0.4f;
+    float gravityScale = 1.0f;
+    float linearDamping = 0.01f;
+    float angularDamping = 0.01f;
+    bool canSleep = false;
+    bool isStatic = false;
+    CollisionFilter2D filter;           // layers, e.g. projectiles that ignore each other
+
+    glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f};
+    glm::vec4 outlineColor = {0.0f, 0.0f, 0.0f, 1.0f};
+    glm::vec4 collidingColor = {1.0f, 0.0f, 0.0f, 1.0f};
+};
+
+/*
+One independent simulation: broadphase, bodies, joints, fluid, settings and step scratch memory.
+Colliders are created through a world (CreateCollision) and bodies join the world of their
+collider, so worlds never see each other's objects and several can run side by side.
+Different worlds can be built, stepped and destroyed on different threads (their JobServer passes take turns):
+the process-wide pools (ObjectPool, ShapeLibrary) are locked and shape references are atomic.
+One world still belongs to one thread at a time.
+*/
+class PhysicsWorld {
+public:
+    explicit PhysicsWorld(const AABB& bounds = AABB(640.0f, 360.0f, 640.0f, 360.0f));
+    ~PhysicsWorld();    // deletes every body and collider still in the world
+    PhysicsWorld(const PhysicsWorld&) = delete;
+    PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+    // Settings
+    float Gravity = 980.0f;
+    glm::vec2 GravityDirection = {0, 1};
+    int SolverIterations = 8;       // cap on the velocity iterations shared by contacts and joints
+    int MinSolverIterations = 2;
+    float SolverTolerance = 1.0f;           // stop once the residual is below this
+    float PenetrationTolerance = 2.0f;      // deeper contacts always run up to the cap
+    SolverMode Mode = SolverMode::SequentialImpulse;
+
+    SolverStats Stats;
+
+    // Step temporaries (vertices, edges, contacts, pairs), rewound at the start of every Update()
+    FrameArena Arena;
+
+    // Attached parts: child poses follow their parents before every broadphase update and after the step
+    TransformHierarchy Hierarchy;
+
+    void Update(float delta);
+    void Render();
+
+    // Colliders are bound to this world (broadphase), bodies built on them follow
+    Collision2D* CreateCollision(
+        const Shape2D* shape,
+        glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f},
+        glm::vec4 outline_color = {0.0f, 0.0f, 0.0f, 1.0f},
+        glm::vec4 colliding_color = {1.0f, 0.0f, 0.0f, 1.0f});
+    // Deletes every body, collider, joint and particle
+    void Clear();
+
+    // Bulk creation / removal (explosions, debris). Spawning grows the body store and the
+    // broadphase once for the whole batch; handles[i] (optional) receives body i.
+    // Destroying is O(1) per body, stale handles are skipped. Joints on those bodies are dropped by the next step.
+    void SpawnBodies(std::span<const BodyDesc2D> bodies, std::span<Handle<RigidBody2D>> handles = {});
+    void DestroyBodies(std::span<const Handle<RigidBody2D>> handles);
+
+    // Systems: each keeps its own state and reaches the others through its world
+    class CollisionSystem
+    {
+    public:
+        CollisionSystem(PhysicsWorld& _world, const AABB& bounds) : SpatialGrid(bounds), world(_world) {}
+        CollisionSpatialGrid SpatialGrid;
+        uint32_t NextId = 0;        // Collision2D::id of the next collider, per world so other worlds can't shift the order
+        void Detect();
+    private:
+        PhysicsWorld& world;
+    };
+
+    class RigidBodySystem {
+    public:
+        explicit RigidBodySystem(PhysicsWorld& _world) : world(_world) {}
+        RigidBodyStore Store;
+        void Step(float delta);
+
+        // Solver
+        void Solve(RigidBody2D* obj, const Collision2DInfos& info);
+        void SolvePositions(RigidBody2D* obj, const Collision2DInfos& info);
+    private:
+        void SolveToStaticBody(RigidBody2D* obj, PhysicsBody2D* other, const Collision2DInfos& info);
+        void SolveToDynamicBody(RigidBody2D* obj, RigidBody2D* other, const Collision2DInfos& info);
+        void CorrectToStaticBody(RigidBody2D* obj, PhysicsBody2D* other, const Collision2DInfos& info);
+        void CorrectToDynamicBody(RigidBody2D* obj, RigidBody2D* other, const Collision2DInfos& info);
+
+        float Residual = 0.0f;      // worst approaching contact velocity of the current iteration
+        PhysicsWorld& world;
+    };
+
+    class JointSystem {
+    public:
+        explicit JointSystem(PhysicsWorld& _world);
+        ~JointSystem();
+
+        // Type-bucketed joint storage, each bucket is solved in its own tight loop
+        std::vector<DistanceJoint2D> DistanceJoints;
+        std::vector<SpringJoint2D> SpringJoints;
+        std::vector<RevoluteJoint2D> RevoluteJoints;
+        std::vector<PrismaticJoint2D> PrismaticJoints;
+        std::vector<WeldJoint2D> WeldJoints;
+
+        // Anchors are given in world space, a null body pins to the world
+        JointHandle2D AddDistance(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchorA, glm::vec2 anchorB);
+        JointHandle2D AddSpring(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchorA, glm::vec2 anchorB, float frequency = 4.0f, float dampingRatio = 0.5f);
+        JointHandle2D AddRevolute(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor);
+        JointHandle2D AddPrismatic(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor, glm::vec2 axis);
+        JointHandle2D AddWeld(RigidBody2D* a, RigidBody2D* b, glm::vec2 anchor);
+        // Stale handles (removed or pruned joints) are ignored
+        void Remove(JointHandle2D handle);
+        bool Contains(JointHandle2D handle) const;
+        void Clear();
+        // Drops the joints whose bodies were destroyed (start of every step), keeping the order of the rest
+        void Prune();
+
+        // Direct joints skip the iterative loop and are solved exactly as a tree (see DirectSolver.cpp)
+        void SetDirect(JointHandle2D handle, bool direct);
+
+        void Prepare(float delta);
+        float Solve();
+        void PrepareDirect();
+        void SolveDirect();
+
+        // XPBD: one positional projection per substep
+        void Project(float delta, float compliance);
+    private:
+        JointHandle2D Issue(JointType2D type, uint32_t index);   // slot for the joint just appended at index
+        uint32_t Find(JointHandle2D handle) const;              // bucket index, UINT32_MAX if stale
+
+        JointSlots2D Slots[JointTypeCount2D];   // handle indirection, one table per bucket
+        struct DirectSolver;
+        std::unique_ptr<DirectSolver> Direct;   // factorization scratch, reused every step
+        PhysicsWorld& world;
+    };
+
+    // Deterministic mode: stable pair order and a per-step hash of the world state
+    class DeterminismSystem {
+    public:
+        explicit DeterminismSystem(PhysicsWorld& _world) : world(_world) {}
+        bool Enabled = false;
+        std::vector<uint64_t> History;      // one hash per step while enabled
+
+        uint64_t Hash() const;              // FNV-1a over every body state (bit exact)
+        void Record();
+        bool SaveHistory(const std::string& path) const;
+
+        // First step where the two histories differ, -1 if they agree on their common length
+        static int64_t FirstDivergence(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+        static bool LoadHistory(const std::string& path, std::vector<uint64_t>& history);
+    private:
+        PhysicsWorld& world;
+    };
+
+    // Rollback: copies the body, joint warm start, LOD, touching pair and fluid state in and out of a PhysicsSnapshot.
+    class SnapshotSystem {
+    public:
+        explicit SnapshotSystem(PhysicsWorld& _world) : world(_world) {}
+        void Capture(PhysicsSnapshot& snapshot, uint32_t frame = 0);
+        // Restores in place; false (nothing touched) if bodies or joints were added / removed or the store was reordered since
+        bool Restore(const PhysicsSnapshot& snapshot);
+    private:
+        PhysicsWorld& world;
+    };
+
+    // Per-region simulation level of detail around focus points (camera, players)
+    class LODSystem {
+    public:
+        explicit LODSystem(PhysicsWorld& _world) : world(_world) {}
+        bool Enabled = false;
+        std::vector<glm::vec2> FocusPoints;     // refreshed by the game every frame
+        float RegionSize = 512.0f;              // bodies take the level of their region
+        float ReducedDistance = 2000.0f;
+        float FrozenDistance = 5000.0f;
+        float Hysteresis = 256.0f;              // distance band to cross before switching level
+        int ReducedRate = 4;
+
+        void Update(float delta);
+        SimulationLOD Level(const RigidBody2D* body) const;
+        // Low-LOD body not stepped this frame: the solvers treat it as static
+        bool Idle(const RigidBody2D* body) const;
+        // Idle bodies skip detection against each other
+        bool SkipsPair(const Collision2D* a, const Collision2D* b) const;
+        void Reset();
+        uint32_t Frame = 0;     // drives the Reduced stagger, part of snapshots
+    private:
+        bool Applied = false;
+        PhysicsWorld& world;
+    };
+
+    // Mutual attraction between every rigid body (Barnes-Hut, O(n log n))
+    class GravitySystem {
+    public:
+        explicit GravitySystem(PhysicsWorld& _world) : world(_world) {}
+        bool Enabled = false;
+        float Constant = 1000.0f;       // G
+        float Theta = 0.5f;             // opening angle, 0 = exact pairwise sum
+        float Softening = 5.0f;         // keeps close encounters finite
+
+        void Apply();
+    private:
+        struct Node {
+            float centerX, centerY, half;   // square cell
+            float mass = 0.0f;
+            float comX = 0.0f, comY = 0.0f; // center of mass
+            int firstChild = -1;            // 4 consecutive children, -1 = leaf
+            uint32_t first = 0, count = 0;  // slice of Points
+        };
+        struct Point {
+            float x, y, mass;
+            uint32_t body;                  // store index
+        };
+        std::vector<Node> Tree;
+        std::vector<Point> Points;      // grouped by leaf
+
+        void Build();
+        void Split(int node, int depth);
+        glm::vec2 Accumulate(uint32_t body) const;
+        PhysicsWorld& world;
+    };
+
+    // Smoothed-particle hydrodynamics (weakly compressible)
+    class FluidSystem {
+    public:
+        explicit FluidSystem(PhysicsWorld& _world) : world(_world) {}
+        FluidStore Particles;
+
+        float SmoothingRadius = 16.0f;      // h, also the grid cell size
+        float ParticleMass = 1.0f;
+        float RestDensity = 1.0f / 64.0f;   // ≈ ParticleMass / spacing² (spacing = h / 2)
+        float Stiffness = 1000000.0f;       // pressure = k * (ρ - ρ0), speed of sound = √k
+        float Viscosity = 8.0f;
+        int Substeps = 1;                   // minimum, raised to respect the CFL limit
+        int MaxSubsteps = 16;
+        FluidCoupling Coupling = FluidCoupling::TwoWay;
+        AABB Bounds = AABB(640.0f, 360.0f, 640.0f, 360.0f);    // particles stay inside
+
+        void Spawn(glm::vec2 position, glm::vec2 velocity = glm::vec2(0.0f));
+        void SpawnBlock(glm::vec2 min, glm::vec2 max, float spacing);
+        void Step(float delta);
+        void Render();
+    private:
+        // Cell sorted grid, rebuilt by counting sort every substep
+        int GridWidth = 0, GridHeight = 0;
+        std::vector<uint32_t> CellStart;    // GridWidth * GridHeight + 1 offsets
+        std::vector<uint32_t> CellOf;
+        std::vector<uint32_t> Order;
+        std::vector<uint32_t> Cursor;       // scatter position per cell
+        std::vector<float> Scratch;
+
+        void BuildGrid();
+        void ComputeDensity();
+        void ComputeForces();
+        void Integrate(float delta);
+        void CoupleBodies();
+        PhysicsWorld& world;
+    };
+
+    // Cache locality: every Interval steps the body store is sorted by the Morton (Z-order) code of
+    // the positions, so bodies close in space are close in memory, and the broadphase objects are put
+    // back in memory order (see ReorderSystem.cpp). Handles and pointers are unaffected, store indices
+    // are patched. Changes the solve order (still deterministic); snapshots taken before a reorder no
+    // longer restore and index matched replication needs it off.
+    class ReorderSystem {
+    public:
+        explicit ReorderSystem(PhysicsWorld& _world) : world(_world) {}
+        bool Enabled = false;
+        int Interval = 60;          // steps between two reorders
+        uint32_t Frame = 0;         // steps since the last one, part of snapshots
+        uint32_t Reorders = 0;      // reorders that moved something
+
+        void Update();
+        void Apply();               // sorts now (skipped when already in order)
+    private:
+        PhysicsWorld& world;
+    };
+
+    // Contact events: the touching pairs of every step are diffed against the previous step's, giving
+    // one buffer of Begin / Persist / End events sorted by pair. Listeners get the whole buffer after
+    // each Update(), so gameplay only visits the pairs that changed instead of polling every collider.
+    class ContactSystem {
+    public:
+        explicit ContactSystem(PhysicsWorld& _world) : world(_world) {}
+        bool Enabled = false;
+        bool ReportPersist = true;              // off: Begin / End only
+        int EndDelay = 1;                       // steps a pair may stay apart before End (resting contacts
+                                                // the position correction pushes out every other step)
+        std::vector<ContactEvent2D> Events;     // last step's events, rewritten by every Update()
+        std::vector<std::function<void(std::span<const ContactEvent2D>)>> Listeners;
+
+        void Record();      // after a solve pass: stages the touching pairs and their impulses
+        void Publish();     // end of the step: builds Events and calls the listeners
+        void Reset();
+    private:
+        struct Touch {
+            uint64_t key;                       // (lower id << 32) | higher id
+            uint32_t order;                     // staging order, the last substep wins
+            Collision2D* a;
+            Collision2D* b;
+            glm::vec2 normal, point;
+            float impulse;
+        };
+        struct Pair {
+            uint64_t key;
+            Handle<Collision2D> a, b;
+            int missed;                         // steps apart so far
+        };
+        std::vector<Touch> Staged;
+        std::vector<Pair> Touching;     // sorted by key
+        std::vector<Pair> Next;
+        bool Held(const Collision2D* a, const Collision2D* b) const;
+        friend class SnapshotSystem;
+        PhysicsWorld& world;
+    };
+
+    class XPBDSystem {
+    public:
+        explicit XPBDSystem(PhysicsWorld& _world) : world(_world) {}
+        int Substeps = 8;
+        float ContactCompliance = 0.0f;     // inverse stiffness (0 = rigid)
+        float JointCompliance = 0.0f;
+
+        void Step(float delta);
+    private:
+        struct Contact {
+            RigidBody2D* a;
+            RigidBody2D* b;             // null for static colliders and bodies held still by LOD
+            glm::vec2 normal;           // pushes A out of B
+            glm::vec2 rA, rB;
+            float normalVelocity;       // relative normal velocity before projection
+            float lambda;               // normal position impulse
+            float* impulse;             // the pair's Collision2DInfos::Impulse slot
+            float restitution;
+            float friction;
+        };
+        std::vector<Contact> Contacts;
+
+        void ProjectContacts(float delta);
+        void SolveContactVelocities(float delta);
+        PhysicsWorld& world;
+    };
+
+    CollisionSystem Collisions;
+    RigidBodySystem RigidBodies;
+    JointSystem Joints;
+    DeterminismSystem Determinism;
+    SnapshotSystem Snapshots;
+    LODSystem LOD;
+    GravitySystem MutualGravity;
+    FluidSystem Fluid;
+    ReorderSystem Reorder;
+    ContactSystem Contacts;
+    XPBDSystem XPBD;
+};
@@ -0,0 +1,68 @@
+#include "PhysicsWorld.hpp"
+#include <algorithm>
+
+/*
+Periodic reordering (keys sorted as (key << 32 | slot): stable, sorted input is left alone):
+    RigidBodyStore   by Morton (Z-order) code of the position, quantized to 16 bits per axis over the
+                     board: the lanes are read by index, so bodies touching each other end up a few slots apart
+    grid Objects     by collider address: the broadphase reads every collider through its pointer and the
+                     pool slots never move, so walking them in memory order is what keeps those reads
+                     sequential once spawn / despawn churn has scrambled the slots (the cell sort already
+                     groups neighbors)
+*/
+
+// 0b abcd -> 0b 0a0b0c0d
+static uint32_t SpreadBits(uint32_t v) {
+    v &= 0xFFFF;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+static uint32_t MortonCode(const AABB& board, glm::vec2 position) {
+    const glm::vec2 size = glm::max(board.getSize(), glm::vec2(1e-6f));
+    const glm::vec2 t = glm::clamp((position - board.min) / size, glm::vec2(0.0f), glm::vec2(1.0f)) * 65535.0f;
+    return SpreadBits(uint32_t(t.x)) | (SpreadBits(uint32_t(t.y)) << 1);
+}
+
+// Slot order by key(slot), empty when the slots are already in order
+template <typename Key>
+static std::span<const uint32_t> SortedOrder(FrameArena& arena, size_t count, Key key) {
+    std::span<uint64_t> keys = arena.Allocate<uint64_t>(count);
+    for (size_t i = 0; i < count; i++) keys[i] = (uint64_t(key(i)) << 32) | uint64_t(i);
+    if (std::is_sorted(keys.begin(), keys.end())) return {};
+
+    std::sort(keys.begin(), keys.end());
+    std::span<uint32_t> order = arena.Allocate<uint32_t>(count);
+    for (size_t k = 0; k < count; k++) order[k] = uint32_t(keys[k]);
+    return order;
+}
+
+void PhysicsWorld::ReorderSystem::Update()
+{
+    if (!Enabled) return;
+    if (++Frame < uint32_t(std::max(Interval, 1))) return;
+    Frame = 0;
+    Apply();
+}
+
+void PhysicsWorld::ReorderSystem::Apply()
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    CollisionSpatialGrid& grid = world.Collisions.SpatialGrid;
+    bool moved = false;
+
+    std::span<const uint32_t> bodies = SortedOrder(world.Arena, store.Size(), [&](size_t i) {
+        return MortonCode(grid.Board, {store.positionX[i], store.positionY[i]});
+    });
+    if (!bodies.empty()) {
+        store.Permute(bodies, world.Arena);
+        moved = true;
+    }
+
+    if (grid.SortByAddress()) moved = true;
+
+    if (moved) Reorders++;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// LSB first bit stream over a byte buffer
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<uint8_t>& buffer) : Buffer(buffer) { Buffer.clear(); }
+
+    void Write(uint32_t value, int bits) {
+        Scratch |= uint64_t(value & Mask(bits)) << Count;
+        Count += bits;
+        while (Count >= 8) {
+            Buffer.push_back(uint8_t(Scratch));
+            Scratch >>= 8;
+            Count -= 8;
+        }
+    }
+
+    void WriteBool(bool value) { Write(value ? 1u : 0u, 1); }
+
+    // Flushes the last partial byte
+    void Finish() {
+        if (Count > 0) Buffer.push_back(uint8_t(Scratch));
+        Scratch = 0;
+        Count = 0;
+    }
+
+    static uint32_t Mask(int bits) { return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u; }
+
+private:
+    std::vector<uint8_t>& Buffer;
+    uint64_t Scratch = 0;
+    int Count = 0;
+};
+
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size) : Data(data), Size(size) {}
+
+    uint32_t Read(int bits) {
+        while (Count < bits) {
+            // Reading past the end yields zeros and flags the stream
+            uint64_t byte = Offset < Size ? Data[Offset] : 0;
+            if (Offset >= Size) Overflow = true;
+            Offset++;
+            Scratch |= byte << Count;
+            Count += 8;
+        }
+        uint32_t value = uint32_t(Scratch) & BitWriter::Mask(bits);
+        Scratch >>= bits;
+        Count -= bits;
+        return value;
+    }
+
+    bool ReadBool() { return Read(1) != 0; }
+    bool Overflowed() const { return Overflow; }
+    size_t BitsLeft() const { return (Offset < Size ? (Size - Offset) * 8 : 0) + size_t(Count); }
+
+private:
+    const uint8_t* Data;
+    size_t Size;
+    size_t Offset = 0;
+    uint64_t Scratch = 0;
+    int Count = 0;
+    bool Overflow = false;
+};
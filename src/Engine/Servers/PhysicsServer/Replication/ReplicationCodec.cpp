@@ -0,0 +1,200 @@
+#include "ReplicationCodec.hpp"
+#include "BitPacker.hpp"
+#include <Engine/Servers/PhysicsServer/PhysicsWorld.hpp>
+
+namespace Replication {
+
+// ----------------- Quantization ---------------
+void Quantize(const PhysicsWorld& world, Frame& frame, uint32_t tick)
+{
+    const RigidBodyStore& store = world.RigidBodies.Store;
+    frame.tick = tick;
+    frame.bodies.resize(store.Size());
+
+    for (size_t i = 0; i < store.Size(); i++) {
+        QuantizedBody& q = frame.bodies[i];
+        q.x = int32_t(std::lround(store.positionX[i] * PositionScale));
+        q.y = int32_t(std::lround(store.positionY[i] * PositionScale));
+        q.rotation = uint16_t(int32_t(std::lround(orientation_to_degrees({store.rotationCos[i], store.rotationSin[i]}) * RotationScale)) & 0xFFFF);
+        q.sleeping = store.HasFlag(uint32_t(i), RigidBodyStore::Sleeping);
+    }
+}
+
+static bool Same(const QuantizedBody& a, const QuantizedBody& b) {
+    return a.x == b.x && a.y == b.y && a.rotation == b.rotation && a.sleeping == b.sleeping;
+}
+
+// ------------------- Deltas -------------------
+// zigzag, then a 2 bit size class: 0 | 6 bits | 14 bits | 32 bits
+static void WriteDelta(BitWriter& writer, int32_t delta) {
+    const uint32_t u = (uint32_t(delta) << 1) ^ uint32_t(delta >> 31);
+    if (u == 0)             writer.Write(0, 2);
+    else if (u < (1u << 6))  { writer.Write(1, 2); writer.Write(u, 6); }
+    else if (u < (1u << 14)) { writer.Write(2, 2); writer.Write(u, 14); }
+    else                     { writer.Write(3, 2); writer.Write(u, 32); }
+}
+
+static int32_t ReadDelta(BitReader& reader) {
+    static constexpr int Bits[4] = {0, 6, 14, 32};
+    const int bits = Bits[reader.Read(2)];
+    const uint32_t u = bits ? reader.Read(bits) : 0;
+    return int32_t(u >> 1) ^ -int32_t(u & 1);
+}
+
+// Rotation deltas wrap around the turn
+static int32_t RotationDelta(uint16_t from, uint16_t to) { return int16_t(uint16_t(to - from)); }
+
+// ------------------- Encoder ------------------
+void Encoder::Encode(uint32_t tick, std::vector<uint8_t>& packet)
+{
+    Frame current;
+    Quantize(*World, current, tick);
+
+    const Frame* base = nullptr;
+    if (Acked != NoBaseline && History[Acked % History.size()].tick == Acked)
+        base = &History[Acked % History.size()];
+
+    // What the client will rebuild (skipped bodies keep their baseline state)
+    Frame& sent = History[tick % History.size()];
+    sent.tick = tick;
+    sent.bodies.resize(current.bodies.size());
+
+    BitWriter writer(packet);
+    writer.Write(tick, 32);
+    writer.Write(base ? base->tick : NoBaseline, 32);
+    writer.Write(uint32_t(current.bodies.size()), 32);
+
+    const QuantizedBody zero;
+    for (size_t i = 0; i < current.bodies.size(); i++) {
+        const QuantizedBody& q = current.bodies[i];
+        const bool known = base && i < base->bodies.size();
+        const QuantizedBody& b = known ? base->bodies[i] : zero;
+
+        // Sleeping bodies are not streamed once the client has them asleep
+        const bool skip = known && (Same(q, b) || (q.sleeping && b.sleeping));
+        writer.WriteBool(!skip);
+        if (skip) {
+            sent.bodies[i] = b;
+            continue;
+        }
+
+        writer.WriteBool(q.sleeping);
+        WriteDelta(writer, q.x - b.x);
+        WriteDelta(writer, q.y - b.y);
+        WriteDelta(writer, RotationDelta(b.rotation, q.rotation));
+        sent.bodies[i] = q;
+    }
+    writer.Finish();
+}
+
+void Encoder::Acknowledge(uint32_t tick)
+{
+    if (Acked == NoBaseline || tick > Acked) Acked = tick;
+}
+
+// ------------------- Decoder ------------------
+bool Decoder::Decode(const std::vector<uint8_t>& packet)
+{
+    BitReader reader(packet.data(), packet.size());
+    const uint32_t tick = reader.Read(32);
+    const uint32_t baseline = reader.Read(32);
+    const uint32_t count = reader.Read(32);
+
+    // Untrusted: every body takes at least one bit
+    if (reader.Overflowed() || count > reader.BitsLeft() || count > MaxBodies) return false;
+
+    const Frame* base = nullptr;
+    if (baseline != NoBaseline) {
+        base = &History[baseline % History.size()];
+        if (base->tick != baseline) return false;
+    }
+
+    Frame frame;
+    frame.tick = tick;
+    frame.bodies.resize(count);
+
+    const QuantizedBody zero;
+    for (uint32_t i = 0; i < count; i++) {
+        const bool known = base && i < base->bodies.size();
+        const QuantizedBody& b = known ? base->bodies[i] : zero;
+
+        if (!reader.ReadBool()) {
+            frame.bodies[i] = b;
+            continue;
+        }
+
+        QuantizedBody& q = frame.bodies[i];
+        q.sleeping = reader.ReadBool();
+        q.x = b.x + ReadDelta(reader);
+        q.y = b.y + ReadDelta(reader);
+        q.rotation = uint16_t(b.rotation + ReadDelta(reader));
+    }
+    if (reader.Overflowed()) return false;
+
+    History[tick % History.size()] = std::move(frame);
+    if (Last == NoBaseline || tick > Last) Last = tick;
+    return true;
+}
+
+void Decoder::Apply() const
+{
+    if (Last == NoBaseline) return;
+    RigidBodyStore& store = World->RigidBodies.Store;
+    const Frame& frame = Latest();
+
+    const size_t count = std::min(frame.bodies.size(), store.Size());
+    for (size_t i = 0; i < count; i++) {
+        const QuantizedBody& q = frame.bodies[i];
+        RigidBody2D* body = store.owners[i];
+        body->setPosition({q.x / PositionScale, q.y / PositionScale});
+        body->setRotation(q.rotation / RotationScale);
+        store.SetFlag(uint32_t(i), RigidBodyStore::Sleeping, q.sleeping);
+    }
+}
+
+// ------------------ Loopback ------------------
+LoopbackStats MeasureLoopback(PhysicsWorld& world, int ticks, float delta, int ackDelay)
+{
+    LoopbackStats stats;
+    if (ticks <= 0) return stats;
+
+    // The client decodes into the same world: Apply() is never called, only the frames are compared
+    Encoder encoder(world);
+    Decoder decoder(world);
+    std::vector<uint8_t> packet;
+    std::vector<uint32_t> pendingAcks;
+    Frame truth;
+    size_t bytes = 0;
+
+    for (int t = 0; t < ticks; t++) {
+        world.Update(delta);
+
+        const uint32_t tick = uint32_t(t);
+        encoder.Encode(tick, packet);
+        bytes += packet.size();
+
+        if (decoder.Decode(packet)) pendingAcks.push_back(tick);
+
+        // Acks arrive ackDelay ticks later
+        while (!pendingAcks.empty() && pendingAcks.front() + uint32_t(std::max(ackDelay, 0)) <= tick) {
+            encoder.Acknowledge(pendingAcks.front());
+            pendingAcks.erase(pendingAcks.begin());
+        }
+
+        // Every streamed (awake) body must come out exactly as quantized
+        Quantize(world, truth, tick);
+        const Frame& received = decoder.Latest();
+        for (size_t i = 0; i < truth.bodies.size(); i++) {
+            const QuantizedBody& q = truth.bodies[i];
+            if (q.sleeping) continue;
+            if (i >= received.bodies.size() || !Same(q, received.bodies[i])) stats.mismatches++;
+        }
+    }
+
+    const size_t count = world.RigidBodies.Store.Size();
+    stats.bytesPerTick = double(bytes) / ticks;
+    stats.rawBytesPerTick = double(count * 3 * sizeof(float));
+    return stats;
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class PhysicsWorld;
+
+/*
+World state replication (server -> clients):
+    positions quantized to 1 / PositionScale px, rotations to 16 bits per turn
+    each tick is delta encoded against the last frame the client acknowledged
+    unchanged and sleeping bodies cost one bit, deltas use a 2 bit size class
+Bodies are matched by RigidBodyStore index: server and client must spawn / remove in the same order.
+*/
+
+namespace Replication {
+    constexpr float PositionScale = 64.0f;
+    constexpr float RotationScale = 65536.0f / 360.0f;
+    constexpr uint32_t NoBaseline = 0xFFFFFFFFu;
+
+    struct QuantizedBody {
+        int32_t x = 0, y = 0;
+        uint16_t rotation = 0;
+        bool sleeping = false;
+    };
+
+    struct Frame {
+        uint32_t tick = NoBaseline;
+        std::vector<QuantizedBody> bodies;
+    };
+
+    // Current RigidBodyStore state of the world
+    void Quantize(const PhysicsWorld& world, Frame& frame, uint32_t tick);
+
+    class Encoder {
+    public:
+        explicit Encoder(const PhysicsWorld& world, size_t history = 64) : World(&world), History(history) {}
+
+        // Encodes the current world against the last acknowledged frame (full state if none)
+        void Encode(uint32_t tick, std::vector<uint8_t>& packet);
+        void Acknowledge(uint32_t tick);
+
+    private:
+        const PhysicsWorld* World;
+        std::vector<Frame> History;     // sent frames, by tick % size
+        uint32_t Acked = NoBaseline;
+    };
+
+    class Decoder {
+    public:
+        explicit Decoder(PhysicsWorld& world, size_t history = 64) : World(&world), History(history) {}
+
+        size_t MaxBodies = 1 << 20;     // larger counts are rejected before anything is allocated
+
+        // False (nothing changes) when the baseline was never received / already overwritten,
+        // or the packet is malformed: truncated, or more bodies than its bits / MaxBodies allow
+        bool Decode(const std::vector<uint8_t>& packet);
+        const Frame& Latest() const { return History[Last % History.size()]; }
+        uint32_t LatestTick() const { return Last; }
+
+        // Writes the latest frame into the local bodies
+        void Apply() const;
+
+    private:
+        PhysicsWorld* World;
+        std::vector<Frame> History;     // received frames, by tick % size
+        uint32_t Last = NoBaseline;
+    };
+
+    // Loopback harness: steps the world `ticks` times, encodes every tick, decodes it
+    // as a client acknowledging `ackDelay` ticks later, and checks the decoded state.
+    struct LoopbackStats {
+        double bytesPerTick = 0.0;
+        double rawBytesPerTick = 0.0;   // full floats for every body (x, y, rotation)
+        size_t mismatches = 0;          // bodies decoded differently than quantized on the server
+    };
+    LoopbackStats MeasureLoopback(PhysicsWorld& world, int ticks, float delta, int ackDelay = 2);
+}
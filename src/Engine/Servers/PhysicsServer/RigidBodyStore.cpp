@@ -0,0 +1,286 @@
+#include "RigidBodyStore.hpp"
+#include <Engine/Object/2D/PhysicsBody2D/RigidBody2D.hpp>
+
+using namespace SIMD;
+
+// ---------------- Storage ----------------
+void RigidBodyStore::ResizePadded(size_t count)
+{
+    // Float lanes are padded to the SIMD width so the batch loops never need a scalar tail.
+    // Padding lanes are zero (inactive) and never touched by Gather/Scatter.
+    const size_t padded = (count + Width - 1) / Width * Width;
+    for (std::vector<float>* lane : FloatArrays()) lane->resize(padded, 0.0f);
+}
+
+void RigidBodyStore::Reserve(size_t count)
+{
+    const size_t padded = (count + Width - 1) / Width * Width;
+    for (std::vector<float>* lane : FloatArrays()) lane->reserve(padded);
+    flags.reserve(count);
+    lod.reserve(count);
+    owners.reserve(count);
+    transforms.reserve(count);
+}
+
+uint32_t RigidBodyStore::Add(RigidBody2D* owner, Transform2D* transform)
+{
+    const uint32_t index = static_cast<uint32_t>(owners.size());
+    owners.push_back(owner);
+    transforms.push_back(transform);
+    flags.push_back(0);
+    lod.push_back(0);
+    ResizePadded(owners.size());
+    timeScale[index] = 1.0f;
+
+    positionX[index] = transform->position.x;
+    positionY[index] = transform->position.y;
+    rotationCos[index] = transform->orientation.x;
+    rotationSin[index] = transform->orientation.y;
+    if (transform->getParent()) SetFlag(index, Attached, true);
+    layout++;
+    return index;
+}
+
+void RigidBodyStore::Remove(uint32_t index)
+{
+    // Swap-and-pop: the last body moves into the freed slot and its handle is patched
+    const uint32_t last = static_cast<uint32_t>(owners.size() - 1);
+    if (index != last) {
+        for (std::vector<float>* lane : FloatArrays()) (*lane)[index] = (*lane)[last];
+        flags[index] = flags[last];
+        lod[index] = lod[last];
+        owners[index] = owners[last];
+        transforms[index] = transforms[last];
+        owners[index]->id = index;
+    }
+    for (std::vector<float>* lane : FloatArrays()) (*lane)[last] = 0.0f;
+
+    owners.pop_back();
+    transforms.pop_back();
+    flags.pop_back();
+    lod.pop_back();
+    ResizePadded(owners.size());
+    layout++;
+}
+
+// Out of place through one arena scratch per element type
+template <typename T>
+static void PermuteLane(std::vector<T>& lane, std::span<const uint32_t> order, std::span<T> scratch) {
+    for (size_t k = 0; k < order.size(); k++) scratch[k] = lane[order[k]];
+    std::copy(scratch.begin(), scratch.end(), lane.begin());
+}
+
+void RigidBodyStore::Permute(std::span<const uint32_t> order, FrameArena& arena)
+{
+    const size_t count = order.size();
+    if (count != owners.size() || count == 0) return;
+
+    std::span<float> floats = arena.Allocate<float>(count);
+    for (std::vector<float>* lane : FloatArrays()) PermuteLane(*lane, order, floats);
+    std::span<uint8_t> bytes = arena.Allocate<uint8_t>(count);
+    PermuteLane(flags, order, bytes);
+    PermuteLane(lod, order, bytes);
+    PermuteLane(owners, order, arena.Allocate<RigidBody2D*>(count));
+    PermuteLane(transforms, order, arena.Allocate<Transform2D*>(count));
+
+    for (uint32_t index = 0; index < count; index++) owners[index]->id = index;
+    layout++;
+}
+
+void RigidBodyStore::SetFlag(uint32_t index, Flags flag, bool value)
+{
+    if (value) flags[index] |= flag;
+    else flags[index] &= ~flag;
+    UpdateActive(index);
+}
+
+void RigidBodyStore::UpdateActive(uint32_t index)
+{
+    active[index] = (flags[index] & (Static | Sleeping | Attached)) ? 0.0f : 1.0f;
+}
+
+void RigidBodyStore::SyncAttached()
+{
+    for (size_t i = 0; i < owners.size(); i++) {
+        const bool attached = transforms[i]->getParent() != nullptr;
+        if (attached != HasFlag(uint32_t(i), Attached)) SetFlag(uint32_t(i), Attached, attached);
+    }
+}
+
+// ----------------- Sync -----------------
+void RigidBodyStore::GatherAt(size_t i)
+{
+    const Transform2D* t = transforms[i];
+    positionX[i] = t->position.x;
+    positionY[i] = t->position.y;
+    rotationCos[i] = t->orientation.x;
+    rotationSin[i] = t->orientation.y;
+}
+
+void RigidBodyStore::Gather()
+{
+    for (size_t i = 0, n = owners.size(); i < n; i++) GatherAt(i);
+}
+
+void RigidBodyStore::Scatter()
+{
+    for (size_t i = 0, n = owners.size(); i < n; i++) {
+        if (flags[i] & Attached) {
+            GatherAt(i);
+            continue;
+        }
+        Transform2D* t = transforms[i];
+        t->position = {positionX[i], positionY[i]};
+        t->orientation = {rotationCos[i], rotationSin[i]};
+    }
+}
+
+void RigidBodyStore::GatherAttached()
+{
+    for (size_t i = 0, n = owners.size(); i < n; i++) {
+        if (flags[i] & Attached) GatherAt(i);
+    }
+}
+
+// -------------- Integration -------------
+// q += w * dt * perp(q), renormalized (first order, no trig and no wrapping).
+// Lanes that do not turn keep q bit exact, padding (q = 0) never reaches the division.
+static void IntegrateRotation(float* cosLane, float* sinLane, float4 angle)
+{
+    float4 c = Load(cosLane);
+    float4 s = Load(sinLane);
+    float4 nc = c - s * angle;
+    float4 ns = s + c * angle;
+    float4 invLength = Set(1.0f) / Sqrt(nc * nc + ns * ns);
+    float4 turned = Less(Zero(), angle * angle);
+    Store(cosLane, Select(turned, nc * invLength, c));
+    Store(sinLane, Select(turned, ns * invLength, s));
+}
+
+void RigidBodyStore::IntegrateForces(float delta, glm::vec2 gravity)
+{
+    const float4 dt = Set(delta);
+    const float4 gx = Set(gravity.x);
+    const float4 gy = Set(gravity.y);
+    const float4 one = Set(1.0f);
+    const float4 restThreshold = Set(1e-4f);
+
+    for (size_t i = 0, n = active.size(); i < n; i += Width) {
+        // Inactive lanes (static / sleeping / padding) integrate with dt = 0,
+        // LOD lanes with their own multiple of dt
+        float4 h = Load(&active[i]) * Load(&timeScale[i]) * dt;
+        float4 g = Load(&gravityScale[i]);
+
+        // v += (a + g * gs) * dt
+        // w += α * dt
+        float4 vx = Load(&velocityX[i]) + (Load(&accelerationX[i]) + gx * g) * h;
+        float4 vy = Load(&velocityY[i]) + (Load(&accelerationY[i]) + gy * g) * h;
+        float4 w  = Load(&angularVelocity[i]) + Load(&angularAcceleration[i]) * h;
+
+        // Damping (decay)
+        // v /= (1 + d * dt)
+        float4 linear = one / (one + Load(&linearDamping[i]) * h);
+        vx = vx * linear;
+        vy = vy * linear;
+        w = w * (one / (one + Load(&angularDamping[i]) * h));
+
+        // Snap tiny velocities to rest
+        float4 zero = Zero();
+        float4 resting = Less(vx * vx + vy * vy, restThreshold);
+        vx = Select(resting, zero, vx);
+        vy = Select(resting, zero, vy);
+        w  = Select(Less(w * w, restThreshold * restThreshold), zero, w);
+
+        Store(&velocityX[i], vx);
+        Store(&velocityY[i], vy);
+        Store(&angularVelocity[i], w);
+
+        // Reset accumulators
+        Store(&accelerationX[i], zero);
+        Store(&accelerationY[i], zero);
+        Store(&angularAcceleration[i], zero);
+    }
+}
+
+void RigidBodyStore::IntegrateVelocities(float delta)
+{
+    const float4 dt = Set(delta);
+
+    for (size_t i = 0, n = active.size(); i < n; i += Width) {
+        float4 h = Load(&active[i]) * Load(&timeScale[i]) * dt;
+
+        // x += v * dt
+        Store(&positionX[i], Load(&positionX[i]) + Load(&velocityX[i]) * h);
+        Store(&positionY[i], Load(&positionY[i]) + Load(&velocityY[i]) * h);
+
+        // q += w * dt * perp(q)
+        IntegrateRotation(&rotationCos[i], &rotationSin[i], Load(&angularVelocity[i]) * h);
+    }
+}
+
+// ------------ XPBD Integration ------------
+// Forces are kept across substeps and cleared once per frame (ClearForces)
+void RigidBodyStore::Predict(float delta, glm::vec2 gravity)
+{
+    const float4 dt = Set(delta);
+    const float4 gx = Set(gravity.x);
+    const float4 gy = Set(gravity.y);
+    const float4 one = Set(1.0f);
+
+    for (size_t i = 0, n = active.size(); i < n; i += Width) {
+        float4 h = Load(&active[i]) * Load(&timeScale[i]) * dt;
+        float4 g = Load(&gravityScale[i]);
+
+        float4 linear = one / (one + Load(&linearDamping[i]) * h);
+        float4 vx = (Load(&velocityX[i]) + (Load(&accelerationX[i]) + gx * g) * h) * linear;
+        float4 vy = (Load(&velocityY[i]) + (Load(&accelerationY[i]) + gy * g) * h) * linear;
+        float4 w  = (Load(&angularVelocity[i]) + Load(&angularAcceleration[i]) * h) / (one + Load(&angularDamping[i]) * h);
+
+        Store(&velocityX[i], vx);
+        Store(&velocityY[i], vy);
+        Store(&angularVelocity[i], w);
+
+        // Remember the start pose, then move with the predicted velocity
+        float4 px = Load(&positionX[i]);
+        float4 py = Load(&positionY[i]);
+        Store(&previousX[i], px);
+        Store(&previousY[i], py);
+        Store(&previousCos[i], Load(&rotationCos[i]));
+        Store(&previousSin[i], Load(&rotationSin[i]));
+        Store(&positionX[i], px + vx * h);
+        Store(&positionY[i], py + vy * h);
+        IntegrateRotation(&rotationCos[i], &rotationSin[i], w * h);
+    }
+}
+
+void RigidBodyStore::DeriveVelocities(float delta)
+{
+    const float4 dt = Set(delta);
+    const float4 one = Set(1.0f);
+
+    for (size_t i = 0, n = active.size(); i < n; i += Width) {
+        // Inactive lanes get v = 0, lanes skipped by the LOD keep their velocity
+        float4 scale = Load(&timeScale[i]);
+        float4 h = Load(&active[i]) * scale * dt;
+        float4 moved = Less(Zero(), scale);
+        float4 invH = Select(Less(Zero(), h), one / Max(h, Set(1e-12f)), Zero());
+
+        // v = (x - x_prev) / dt
+        // w = cross(q_prev, q) / dt (sin of the turn, small angle)
+        float4 vx = (Load(&positionX[i]) - Load(&previousX[i])) * invH;
+        float4 vy = (Load(&positionY[i]) - Load(&previousY[i])) * invH;
+        float4 c = Load(&rotationCos[i]);
+        float4 s = Load(&rotationSin[i]);
+        float4 w = (Load(&previousCos[i]) * s - Load(&previousSin[i]) * c) * invH;
+        Store(&velocityX[i], Select(moved, vx, Load(&velocityX[i])));
+        Store(&velocityY[i], Select(moved, vy, Load(&velocityY[i])));
+        Store(&angularVelocity[i], Select(moved, w, Load(&angularVelocity[i])));
+    }
+}
+
+void RigidBodyStore::ClearForces()
+{
+    std::fill(accelerationX.begin(), accelerationX.end(), 0.0f);
+    std::fill(accelerationY.begin(), accelerationY.end(), 0.0f);
+    std::fill(angularAcceleration.begin(), angularAcceleration.end(), 0.0f);
+}
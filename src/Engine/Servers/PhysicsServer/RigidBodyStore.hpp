@@ -0,0 +1,100 @@
+#pragma once
+#include <Math/Math.hpp>
+#include <Math/SIMD.hpp>
+#include <Engine/Component/Transform2D.hpp>
+#include <Engine/Memory/FrameArena.hpp>
+#include <span>
+
+class RigidBody2D;
+
+// Structure-of-arrays storage for every RigidBody2D.
+// RigidBody2D only keeps an index into these arrays, so the integration
+// passes walk contiguous memory and run 4 bodies per SIMD lane.
+class RigidBodyStore {
+public:
+    enum Flags : uint8_t {
+        Static   = 1 << 0,
+        Sleeping = 1 << 1,
+        CanSleep = 1 << 2,
+        Attached = 1 << 3       // child in its world's TransformHierarchy: posed by the parent, static meanwhile
+    };
+
+    // Transform state (mirrored into Transform2D by Gather/Scatter),
+    // rotation as the unit complex number (cos, sin)
+    std::vector<float> positionX, positionY, rotationCos, rotationSin;
+
+    // Start of substep pose (position based solver)
+    std::vector<float> previousX, previousY, previousCos, previousSin;
+
+    // Motion state
+    std::vector<float> velocityX, velocityY, angularVelocity;
+    std::vector<float> accelerationX, accelerationY, angularAcceleration;
+
+    // Material
+    std::vector<float> mass, inverseMass, inertia, inverseInertia;
+    std::vector<float> linearDamping, angularDamping, gravityScale;
+    std::vector<float> restitution, friction;
+
+    // 1.0f when the body is integrated (dynamic and awake), 0.0f otherwise
+    std::vector<float> active;
+    std::vector<uint8_t> flags;
+
+    // Simulation LOD (see PhysicsWorld::LODSystem): this frame's dt multiplier
+    // (0 = skipped, n = catches up n frames) and the time waiting to be stepped
+    std::vector<float> timeScale, lodTime;
+    std::vector<uint8_t> lod;
+
+    // Back references (owner handle and its transform component)
+    std::vector<RigidBody2D*> owners;
+    std::vector<Transform2D*> transforms;
+
+    uint32_t Add(RigidBody2D* owner, Transform2D* transform);
+    void Remove(uint32_t index);
+    void Reserve(size_t count);
+    size_t Size() const { return owners.size(); }
+    size_t Capacity() const { return owners.capacity(); }
+
+    // Slot k takes the body from slot order[k] (every lane, owners' indices patched)
+    void Permute(std::span<const uint32_t> order, FrameArena& arena);
+    // Bumped by Add, Remove and Permute: index based copies (snapshots) taken before are stale
+    uint32_t Layout() const { return layout; }
+
+    // Every per-body float lane, in declaration order
+    std::array<std::vector<float>*, 26> FloatArrays() {
+        return {
+            &positionX, &positionY, &rotationCos, &rotationSin,
+            &previousX, &previousY, &previousCos, &previousSin,
+            &velocityX, &velocityY, &angularVelocity,
+            &accelerationX, &accelerationY, &angularAcceleration,
+            &mass, &inverseMass, &inertia, &inverseInertia,
+            &linearDamping, &angularDamping, &gravityScale,
+            &restitution, &friction,
+            &active,
+            &timeScale, &lodTime
+        };
+    }
+
+    void SetFlag(uint32_t index, Flags flag, bool value);
+    bool HasFlag(uint32_t index, Flags flag) const { return flags[index] & flag; }
+    void SyncAttached();        // Attached from every transform's parent, after the hierarchy links changed
+
+    // Transform2D <-> SoA sync (Scatter reads Attached bodies back: their transform is the hierarchy's)
+    void Gather();
+    void Scatter();
+    void GatherAttached();
+
+    // Batch integration
+    void IntegrateForces(float delta, glm::vec2 gravity);
+    void IntegrateVelocities(float delta);
+
+    // Position based (XPBD) substep integration
+    void Predict(float delta, glm::vec2 gravity);
+    void DeriveVelocities(float delta);
+    void ClearForces();
+
+private:
+    void UpdateActive(uint32_t index);
+    void GatherAt(size_t index);
+    void ResizePadded(size_t count);
+    uint32_t layout = 0;
+};
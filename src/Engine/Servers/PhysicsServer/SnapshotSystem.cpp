@@ -0,0 +1,139 @@
+#include "PhysicsWorld.hpp"
+#include <cstring>
+#include <type_traits>
+
+/*
+Layout (everything is memcpy'd, no pointers):
+    body float lanes (padded size each) | flags | lod
+    joint impulses, bucket by bucket
+    LOD frame, reorder frame
+    contact touching pairs (key, collider handles, steps apart), sorted by key
+    fluid lanes
+*/
+
+namespace {
+
+struct Writer {
+    std::vector<std::byte>& data;
+    size_t offset = 0;
+
+    void Bytes(const void* source, size_t size) {
+        if (offset + size > data.size()) data.resize(offset + size);
+        std::memcpy(data.data() + offset, source, size);
+        offset += size;
+    }
+    template <typename T> void Value(const T& value) { Bytes(&value, sizeof(T)); }
+    template <typename T> void Array(const std::vector<T>& values) { Bytes(values.data(), values.size() * sizeof(T)); }
+};
+
+struct Reader {
+    const std::vector<std::byte>& data;
+    size_t offset = 0;
+
+    void Bytes(void* target, size_t size) {
+        std::memcpy(target, data.data() + offset, size);
+        offset += size;
+    }
+    template <typename T> void Value(T& value) { Bytes(&value, sizeof(T)); }
+    template <typename T> void Array(std::vector<T>& values) { Bytes(values.data(), values.size() * sizeof(T)); }
+};
+
+// Same visitor for both directions: the layout can't drift between Capture and Restore
+template <typename Stream>
+void VisitJoints(Stream& stream, PhysicsWorld::JointSystem& joints) {
+    for (auto& j : joints.DistanceJoints) stream.Value(j.impulse);
+    for (auto& j : joints.SpringJoints) stream.Value(j.impulse);
+    for (auto& j : joints.RevoluteJoints) stream.Value(j.impulse);
+    for (auto& j : joints.PrismaticJoints) { stream.Value(j.linearImpulse); stream.Value(j.angularImpulse); }
+    for (auto& j : joints.WeldJoints) { stream.Value(j.impulse); stream.Value(j.angularImpulse); }
+}
+
+} // namespace
+
+void PhysicsWorld::SnapshotSystem::Capture(PhysicsSnapshot& snapshot, uint32_t frame)
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    FluidStore& fluid = world.Fluid.Particles;
+    JointSystem& joints = world.Joints;
+
+    static_assert(std::is_trivially_copyable_v<ContactSystem::Pair>, "contact pairs are memcpy'd");
+
+    snapshot.frame = frame;
+    snapshot.bodyCount = uint32_t(store.Size());
+    snapshot.jointCounts[0] = uint32_t(joints.DistanceJoints.size());
+    snapshot.jointCounts[1] = uint32_t(joints.SpringJoints.size());
+    snapshot.jointCounts[2] = uint32_t(joints.RevoluteJoints.size());
+    snapshot.jointCounts[3] = uint32_t(joints.PrismaticJoints.size());
+    snapshot.jointCounts[4] = uint32_t(joints.WeldJoints.size());
+    snapshot.particleCount = uint32_t(fluid.Size());
+    snapshot.contactCount = uint32_t(world.Contacts.Touching.size());
+    snapshot.layout = store.Layout();
+
+    // Transforms are mirrors of the store lanes
+    store.Gather();
+
+    Writer writer{snapshot.data};
+    for (std::vector<float>* lane : store.FloatArrays()) writer.Array(*lane);
+    writer.Array(store.flags);
+    writer.Array(store.lod);
+
+    VisitJoints(writer, joints);
+    writer.Value(world.LOD.Frame);
+    writer.Value(world.Reorder.Frame);
+    writer.Array(world.Contacts.Touching);
+
+    for (std::vector<float>* lane : fluid.StateArrays()) writer.Array(*lane);
+
+    snapshot.data.resize(writer.offset);
+}
+
+bool PhysicsWorld::SnapshotSystem::Restore(const PhysicsSnapshot& snapshot)
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    FluidStore& fluid = world.Fluid.Particles;
+    JointSystem& joints = world.Joints;
+
+    if (snapshot.bodyCount != store.Size() || snapshot.layout != store.Layout() ||
+        snapshot.jointCounts[0] != joints.DistanceJoints.size() ||
+        snapshot.jointCounts[1] != joints.SpringJoints.size() ||
+        snapshot.jointCounts[2] != joints.RevoluteJoints.size() ||
+        snapshot.jointCounts[3] != joints.PrismaticJoints.size() ||
+        snapshot.jointCounts[4] != joints.WeldJoints.size())
+        return false;
+
+    Reader reader{snapshot.data};
+    for (std::vector<float>* lane : store.FloatArrays()) reader.Array(*lane);
+    reader.Array(store.flags);
+    reader.Array(store.lod);
+
+    VisitJoints(reader, joints);
+    reader.Value(world.LOD.Frame);
+    reader.Value(world.Reorder.Frame);
+
+    // Pairs hold generational handles: one whose collider is gone since the capture ends on the next step
+    world.Contacts.Touching.resize(snapshot.contactCount);
+    reader.Array(world.Contacts.Touching);
+
+    // Particles are plain data: the count may differ
+    for (std::vector<float>* lane : fluid.StateArrays()) {
+        lane->resize(snapshot.particleCount);
+        reader.Array(*lane);
+    }
+
+    store.Scatter();
+    return true;
+}
+
+// -------------------- Ring --------------------
+void SnapshotRing::Save(uint32_t frame)
+{
+    const size_t slot = frame % Slots.size();
+    World->Snapshots.Capture(Slots[slot], frame);
+    Valid[slot] = true;
+}
+
+bool SnapshotRing::Restore(uint32_t frame)
+{
+    if (!Has(frame)) return false;
+    return World->Snapshots.Restore(Slots[frame % Slots.size()]);
+}
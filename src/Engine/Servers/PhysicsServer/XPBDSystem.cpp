@@ -0,0 +1,151 @@
+#include "PhysicsWorld.hpp"
+
+/*
+Small-step XPBD (one projection per substep):
+    predict x, o from v, w
+    broadphase + narrowphase on the predicted poses
+    project contacts and joints (positions)
+    v = (x - x_prev) / dt
+    restitution + friction (velocities)
+    stage contact events (every substep detects again, see ContactSystem)
+*/
+
+void PhysicsWorld::XPBDSystem::Step(float delta)
+{
+    RigidBodyStore& store = world.RigidBodies.Store;
+    const int substeps = std::max(Substeps, 1);
+    const float h = delta / float(substeps);
+
+    store.Gather();
+    world.Stats = SolverStats();
+    world.Stats.iterations = substeps;
+
+    for (int substep = 0; substep < substeps; substep++) {
+        store.Predict(h, world.Gravity * world.GravityDirection);
+        store.Scatter();
+
+        world.Collisions.Detect();
+
+        ProjectContacts(h);
+        world.Joints.Project(h, JointCompliance);
+
+        store.DeriveVelocities(h);
+        SolveContactVelocities(h);
+        if (world.Contacts.Enabled) world.Contacts.Record();
+    }
+
+    store.Scatter();
+    store.ClearForces();
+}
+
+// ------------------- Contacts -----------------
+static float GeneralizedInverseMass(RigidBody2D* body, const glm::vec2& r, const glm::vec2& n) {
+    if (!body) return 0.0f;
+    float rn = cross(r, n);
+    return body->getInverseMass() + body->getInverseInertia() * rn * rn;
+}
+
+static glm::vec2 PointVelocity(RigidBody2D* body, const glm::vec2& r) {
+    if (!body) return glm::vec2(0.0f);
+    return body->getLinearVelocity() + body->getAngularVelocity() * perp(r);
+}
+
+static void MoveBody(RigidBody2D* body, const glm::vec2& p, const glm::vec2& r) {
+    if (!body || body->IsStatic() || body->IsSleeping()) return;
+    body->setPosition(body->getPosition() + p * body->getInverseMass());
+    body->Rotate(cross(r, p) * body->getInverseInertia());
+}
+
+void PhysicsWorld::XPBDSystem::ProjectContacts(float delta)
+{
+    const float alpha = ContactCompliance / (delta * delta);
+    RigidBodyStore& store = world.RigidBodies.Store;
+    Contacts.clear();
+
+    for (size_t i = 0; i < store.Size(); i++) {
+        RigidBody2D* obj = store.owners[i];
+        if (!obj->collision || obj->IsStatic()) continue;
+        const Collision2DInfos& info = obj->collision->info;
+        if (!info.isPhysicsColliding) continue;
+
+        for (size_t slot = 0; slot < info.PhysicsColliders.size(); slot++) {
+            Collision2D* otherCol = info.PhysicsColliders[slot];
+            glm::vec2 mtv = info.MTV[slot];
+            std::span<const glm::vec2> points = info.ContactPoints[slot];
+            float penetration = glm::length(mtv);
+            world.Stats.maxPenetration = std::max(world.Stats.maxPenetration, penetration);
+            if (penetration < 1e-4f || points.empty()) continue;
+
+            RigidBody2D* other = RigidBody2D::FromCollision(otherCol);
+            if (other && other->IsStatic()) other = nullptr;
+
+            // A body held still by LOD acts as static: the moving one becomes a, b is left null
+            const bool idleA = world.LOD.Idle(obj);
+            const bool idleB = other && world.LOD.Idle(other);
+            if (idleA && (!other || idleB)) continue;
+
+            // One constraint per pair, acting at the mean contact point
+            glm::vec2 point(0.0f);
+            for (const glm::vec2& p : points) point += p;
+            point /= float(points.size());
+
+            Contact c;
+            c.a = idleA ? other : obj;
+            c.b = (idleA || idleB) ? nullptr : other;
+            c.normal = (idleA ? -mtv : mtv) / penetration;
+            c.rA = point - c.a->getPosition();
+            c.rB = c.b ? point - c.b->getPosition() : glm::vec2(0.0f);
+            c.normalVelocity = glm::dot(c.normal, PointVelocity(c.a, c.rA) - PointVelocity(c.b, c.rB));
+            c.restitution = other ? std::min(obj->getRestitution(), other->getRestitution()) : obj->getRestitution();
+            c.friction = other ? std::sqrt(obj->getFriction() * other->getFriction()) : obj->getFriction();
+
+            float w = GeneralizedInverseMass(c.a, c.rA, c.normal) + GeneralizedInverseMass(c.b, c.rB, c.normal);
+            if (w + alpha <= 0.0f) continue;
+
+            c.lambda = penetration / (w + alpha);
+            c.impulse = &info.Impulse[slot];
+            *c.impulse += c.lambda / delta;
+            glm::vec2 p = c.lambda * c.normal;
+            MoveBody(c.a, p, c.rA);
+            MoveBody(c.b, -p, c.rB);
+
+            if (c.b && c.b->IsSleeping()) c.b->WakeUp();
+            Contacts.push_back(c);
+        }
+    }
+}
+
+void PhysicsWorld::XPBDSystem::SolveContactVelocities(float delta)
+{
+    const float restThreshold = 2.0f * world.Gravity * delta;
+
+    for (Contact& c : Contacts) {
+        glm::vec2 relVel = PointVelocity(c.a, c.rA) - PointVelocity(c.b, c.rB);
+        float vn = glm::dot(c.normal, relVel);
+        glm::vec2 vt = relVel - c.normal * vn;
+        glm::vec2 dv(0.0f);
+
+        // Dynamic friction, bounded by the normal force of the projection (λ / dt²)
+        float vtLength = glm::length(vt);
+        if (vtLength > 1e-6f) {
+            float friction = std::min(c.friction * c.lambda / delta, vtLength);
+            dv -= vt * (friction / vtLength);
+        }
+
+        // Restitution against the pre-projection approach velocity
+        float e = (std::abs(c.normalVelocity) > restThreshold) ? c.restitution : 0.0f;
+        dv += c.normal * (-vn + std::max(-e * c.normalVelocity, 0.0f));
+
+        float dvLength = glm::length(dv);
+        if (dvLength < 1e-6f) continue;
+        glm::vec2 dir = dv / dvLength;
+
+        float w = GeneralizedInverseMass(c.a, c.rA, dir) + GeneralizedInverseMass(c.b, c.rB, dir);
+        if (w <= 0.0f) continue;
+
+        glm::vec2 impulse = dv / w;
+        *c.impulse += std::abs(glm::dot(impulse, c.normal));
+        c.a->ApplyImpulse(impulse, c.rA);
+        if (c.b) c.b->ApplyImpulse(-impulse, c.rB);
+    }
+}
@@ -0,0 +1,81 @@
+#include "SystemServer.hpp"
+#include <Engine/Servers/JobServer/JobServer.hpp>
+#include <algorithm>
+#include <chrono>
+
+using Clock = std::chrono::steady_clock;
+
+static float MsSince(Clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+}
+
+SystemServer::SystemId SystemServer::Add(FrameStage stage, std::string name, Run run, bool parallel)
+{
+    // After the systems already in this stage
+    auto at = std::upper_bound(Systems.begin(), Systems.end(), stage, [](FrameStage s, const System& system) {
+        return s < system.stage;
+    });
+    const SystemId id = NextId++;
+    Systems.insert(at, System{id, stage, parallel, std::move(name), std::move(run)});
+    return id;
+}
+
+void SystemServer::Remove(SystemId id)
+{
+    std::erase_if(Systems, [id](const System& system) { return system.id == id; });
+}
+
+void SystemServer::Clear()
+{
+    Systems.clear();
+    std::fill(std::begin(StageTimes), std::end(StageTimes), 0.0f);
+}
+
+float SystemServer::SystemMs(SystemId id)
+{
+    for (const System& system : Systems) {
+        if (system.id == id) return system.ms;
+    }
+    return 0.0f;
+}
+
+float SystemServer::FrameMs()
+{
+    float total = 0.0f;
+    for (float ms : StageTimes) total += ms;
+    return total;
+}
+
+void SystemServer::Update(float delta)
+{
+    auto timed = [delta](System& system) {
+        const Clock::time_point start = Clock::now();
+        system.run(delta);
+        system.ms = MsSince(start);
+    };
+
+    size_t i = 0;
+    for (size_t stage = 0; stage < size_t(FrameStage::Count); stage++) {
+        const Clock::time_point start = Clock::now();
+
+        while (i < Systems.size() && size_t(Systems[i].stage) == stage) {
+            // A run of neighbouring parallel systems is one job, one system per chunk
+            size_t end = i + 1;
+            if (Systems[i].parallel) {
+                while (end < Systems.size() && Systems[end].stage == Systems[i].stage && Systems[end].parallel) end++;
+            }
+            if (end - i == 1) {
+                timed(Systems[i]);
+            }
+            else {
+                System* first = &Systems[i];
+                JobServer::ParallelFor(end - i, 1, [&](size_t begin, size_t last) {
+                    for (size_t k = begin; k < last; k++) timed(first[k]);
+                });
+            }
+            i = end;
+        }
+
+        StageTimes[stage] = MsSince(start);
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+// Frame stages, run in this order by SystemServer::Update
+enum class FrameStage : uint8_t {
+    Input,
+    Physics,
+    LateUpdate,     // game logic reading the stepped world (poses, contact events)
+    Draw,
+    Count
+};
+
+// SERVER
+// Per-frame systems: each one processes a whole object type in one call (every body, every
+// collider) instead of a virtual call per object. Stages run in order; inside a stage systems run
+// in registration order, and neighbouring `parallel` systems run together as JobServer jobs, so
+// they must not share data with each other (nor use Renderer2D / GL, which stay on the main thread).
+class SystemServer {
+public:
+    using SystemId = uint32_t;
+    using Run = std::function<void(float delta)>;
+
+    static SystemId Add(FrameStage stage, std::string name, Run run, bool parallel = false);
+    static void Remove(SystemId id);    // not from inside a system
+    static void Clear();
+
+    static void Update(float delta);
+
+    // Wall time of the last Update(), per stage and per system (0 for unknown ids)
+    static float StageMs(FrameStage stage) { return StageTimes[size_t(stage)]; }
+    static float SystemMs(SystemId id);
+    static float FrameMs();
+
+private:
+    struct System {
+        SystemId id;
+        FrameStage stage;
+        bool parallel;
+        std::string name;
+        Run run;
+        float ms = 0.0f;
+    };
+
+    inline static std::vector<System> Systems;      // sorted by stage, then registration
+    inline static float StageTimes[size_t(FrameStage::Count)] = {};
+    inline static SystemId NextId = 0;
+};
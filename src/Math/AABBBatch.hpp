@@ -0,0 +1,66 @@
+#pragma once
+#include <Math/Math.hpp>
+#include <Math/SIMD.hpp>
+#include <bit>
+#include <span>
+
+// Structure-of-arrays boxes for one-against-many overlap tests, SIMD::Width boxes per compare.
+// The caller owns the storage (4 * Padded(capacity) floats, e.g. from the frame arena).
+// Every lane keeps Width - 1 empty boxes past the last one, so a test may start at any
+// index and the last group needs no scalar tail.
+class AABBBatch {
+public:
+    std::span<float> minX, minY, maxX, maxY;
+
+    static constexpr size_t Padded(size_t capacity) { return capacity + SIMD::Width - 1; }
+
+    AABBBatch() = default;
+    AABBBatch(std::span<float> storage, size_t capacity) {
+        const size_t lane = Padded(capacity);
+        minX = storage.subspan(0, lane);
+        minY = storage.subspan(lane, lane);
+        maxX = storage.subspan(2 * lane, lane);
+        maxY = storage.subspan(3 * lane, lane);
+    }
+
+    size_t Size() const { return count; }
+
+    void Set(size_t index, const AABB& box) {
+        minX[index] = box.min.x;
+        minY[index] = box.min.y;
+        maxX[index] = box.max.x;
+        maxY[index] = box.max.y;
+    }
+
+    // Boxes [0, size) are in use, the padding after them is reset to empty boxes
+    void Resize(size_t size) {
+        count = size;
+        const AABB empty = AABB::Empty();
+        for (size_t i = size; i < size + SIMD::Width - 1; i++) Set(i, empty);
+    }
+
+    // Bit k is set when `box` overlaps box first + k (touching counts, like AABB::intersects)
+    int Overlaps(const AABB& box, size_t first) const {
+        using SIMD::float4, SIMD::Load, SIMD::LessEqual, SIMD::And;
+        float4 x = And(LessEqual(Load(&minX[first]), SIMD::Set(box.max.x)), LessEqual(SIMD::Set(box.min.x), Load(&maxX[first])));
+        float4 y = And(LessEqual(Load(&minY[first]), SIMD::Set(box.max.y)), LessEqual(SIMD::Set(box.min.y), Load(&maxY[first])));
+        return SIMD::MoveMask(And(x, y));
+    }
+
+    // visit(index) for every box in [first, Size()) overlapping `box`, in index order
+    template <typename F>
+    void ForEachOverlap(const AABB& box, size_t first, F&& visit) const {
+        for (size_t i = first; i < count; i += SIMD::Width) {
+            unsigned mask = unsigned(Overlaps(box, i));
+            while (mask) {
+                const size_t index = i + size_t(std::countr_zero(mask));
+                if (index >= count) return;
+                visit(index);
+                mask &= mask - 1;
+            }
+        }
+    }
+
+private:
+    size_t count = 0;
+};
@@ -45,145 +45,96 @@ inline std::ostream& operator<<(std::ostream& os, const std::vector<glm::vec2>&
     return os;
 }
 
+// Axis aligned box as its two corners (16 bytes). The overlap tests are branchless:
+// the four comparisons are combined with & so no early-out branch is taken.
 struct AABB {
-    float x{0.0f};
-    float y{0.0f};
-    float hw{0.0f};
-    float hh{0.0f};
-    glm::vec2 center;
-    glm::vec2 halfSize;
-    glm::vec2 max;
-    glm::vec2 min;
+    glm::vec2 min{0.0f};
+    glm::vec2 max{0.0f};
 
     AABB() = default;
 
-    AABB(float _x, float _y, float _w, float _h) :
-    x(_x),
-    y(_y),
-    hw(_w),
-    hh(_h),
-    center({_x, _y}),
-    halfSize({_w, _h})
-    {
-        max = {x + hw, y + hh};
-        min = {x - hw, y - hh};
-    }
-
-    AABB(float _x, float _y, float _halfSize):
-    x(_x),
-    y(_y),
-    hw(_halfSize),
-    hh(_halfSize),
-    center({_x, _y}),
-    halfSize({_halfSize, _halfSize})
-    {}
-
-    AABB(glm::vec2 _center, glm::vec2 _halfSize):
-    x(_center.x),
-    y(_center.y),
-    hw(_halfSize.x),
-    hh(_halfSize.y),
-    center(_center),
-    halfSize(_halfSize)
-    {}
-
-    AABB(glm::vec2 _center, float _halfSize):
-    x(_center.x),
-    y(_center.y),
-    hw(_halfSize),
-    hh(_halfSize),
-    center(_center),
-    halfSize({_halfSize, _halfSize})
-    {}
+    // Center / half size constructors
+    AABB(float _x, float _y, float _hw, float _hh) : min(_x - _hw, _y - _hh), max(_x + _hw, _y + _hh) {}
+    AABB(float _x, float _y, float _halfSize) : AABB(_x, _y, _halfSize, _halfSize) {}
+    AABB(const glm::vec2& _center, const glm::vec2& _halfSize) : min(_center - _halfSize), max(_center + _halfSize) {}
+    AABB(const glm::vec2& _center, float _halfSize) : AABB(_center, glm::vec2(_halfSize)) {}
 
     AABB(const std::vector<glm::vec2>& verts) {
-        if (verts.empty()) {
-            x = y = hw = hh = 0.0f;
-            return;
+        if (verts.empty()) return;
+        min = max = verts[0];
+        for (const glm::vec2& v : verts) {
+            min = glm::min(min, v);
+            max = glm::max(max, v);
         }
+    }
 
-        float minX = verts[0].x;
-        float minY = verts[0].y;
-        float maxX = verts[0].x;
-        float maxY = verts[0].y;
-
-        for (const auto& v : verts) {
-            if (v.x < minX) minX = v.x;
-            if (v.y < minY) minY = v.y;
-            if (v.x > maxX) maxX = v.x;
-            if (v.y > maxY) maxY = v.y;
-        }
+    static AABB FromMinMax(const glm::vec2& _min, const glm::vec2& _max) {
+        AABB box;
+        box.min = _min;
+        box.max = _max;
+        return box;
+    }
 
-        x = (minX + maxX) * 0.5f;
-        y = (minY + maxY) * 0.5f;
-        hw = (maxX - minX) * 0.5f;
-        hh = (maxY - minY) * 0.5f;
-        center = {x, y};
-        halfSize = {hw, hh};
+    // Inverted box: overlaps and contains nothing (padding for the batch tests)
+    static AABB Empty() {
+        return FromMinMax(glm::vec2(std::numeric_limits<float>::infinity()), glm::vec2(-std::numeric_limits<float>::infinity()));
     }
 
-    std::vector<glm::vec2> getVertices() {
+    glm::vec2 getCenter() const { return (min + max) * 0.5f; }
+    glm::vec2 getHalfSize() const { return (max - min) * 0.5f; }
+    glm::vec2 getSize() const { return max - min; }
+
+    std::vector<glm::vec2> getVertices() const {
         return {
-            {x - hw, y - hh}, // top-left
-            {x + hw, y - hh}, // top-right
-            {x + hw, y + hh}, // bottom-right
-            {x - hw, y + hh}  // bottom-left
+            {min.x, min.y}, // top-left
+            {max.x, min.y}, // top-right
+            {max.x, max.y}, // bottom-right
+            {min.x, max.y}  // bottom-left
         };
     }
 
-    bool contains(const glm::vec2 point) const {
-        return point.x >= x - hw && point.x <= x + hw &&
-               point.y >= y - hh && point.y <= y + hh;
+    bool contains(const glm::vec2& point) const {
+        return (point.x >= min.x) & (point.x <= max.x) & (point.y >= min.y) & (point.y <= max.y);
     }
 
-    bool contains(const std::vector<glm::vec2> points) const {
-        for (glm::vec2 point : points) {
+    bool contains(const std::vector<glm::vec2>& points) const {
+        for (const glm::vec2& point : points) {
             if (!contains(point)) return false;
         }
         return true;
     }
 
     bool contains(const AABB& other) const {
-        return (other.x - other.hw >= x - hw) &&
-            (other.x + other.hw <= x + hw) &&
-            (other.y - other.hh >= y - hh) &&
-            (other.y + other.hh <= y + hh);
+        return (other.min.x >= min.x) & (other.max.x <= max.x) & (other.min.y >= min.y) & (other.max.y <= max.y);
     }
 
-    bool atLeastContains(const std::vector<glm::vec2> points) const {
-        for (glm::vec2 point : points) {
+    bool atLeastContains(const std::vector<glm::vec2>& points) const {
+        for (const glm::vec2& point : points) {
             if (contains(point)) return true;
         }
         return false;
     }
 
-    bool atLeastContains(const glm::vec2 point) const {
-        if (contains(point)) return true;
-        return false;
+    bool atLeastContains(const glm::vec2& point) const {
+        return contains(point);
     }
 
+    // Touching boxes intersect
     bool intersects(const AABB& other) const {
-        return !(other.x - other.hw > x + hw ||
-                 other.x + other.hw < x - hw ||
-                 other.y - other.hh > y + hh ||
-                 other.y + other.hh < y - hh);
+        return (other.min.x <= max.x) & (min.x <= other.max.x) & (other.min.y <= max.y) & (min.y <= other.max.y);
     }
 
     bool operator==(const AABB& other) const {
-        return x == other.x && 
-               y == other.y && 
-               hw == other.hw && 
-               hh == other.hh;
+        return min == other.min && max == other.max;
     }
-    
+
     bool operator!=(const AABB& other) const {
-        return x != other.x && 
-               y != other.y && 
-               hw != other.hw && 
-               hh != other.hh;
+        return !(*this == other);
     }
 };
 
+static_assert(sizeof(AABB) == 16, "AABB is two packed corners");
+
 struct Edge2D {
     glm::vec2 p1, p2;
 
@@ -251,10 +202,45 @@ struct Edge2D {
 inline float deg2rad(float degrees) {return degrees * PI / 180.0f;}
 inline float rad2deg(float radians) {return radians * 180 / PI;}
 
+// Rotations are unit complex numbers q = (cos, sin): trig only when converting from / to degrees
+inline glm::vec2 orientation_from_degrees(float degrees) {
+    float r = deg2rad(degrees);
+    return glm::vec2(cosf(r), sinf(r));
+}
+
+inline float orientation_to_degrees(const glm::vec2 q) {
+    return rad2deg(std::atan2(q.y, q.x));
+}
+
+inline glm::vec2 rotate_local_to_world(const glm::vec2 v_local, const glm::vec2 q) {
+    return glm::vec2(q.x * v_local.x - q.y * v_local.y, q.y * v_local.x + q.x * v_local.y);
+}
+
+inline glm::vec2 rotate_world_to_local(const glm::vec2 v_world, const glm::vec2 q) {
+    return glm::vec2(q.x * v_world.x + q.y * v_world.y, q.x * v_world.y - q.y * v_world.x);
+}
+
 inline glm::vec2 rotate_local_to_world(const glm::vec2 v_local, float rotation_degrees) {
-    float r = glm::radians(rotation_degrees);
-    float c = cosf(r), s = sinf(r);
-    return glm::vec2(c * v_local.x - s * v_local.y, s * v_local.x + c * v_local.y);
+    return rotate_local_to_world(v_local, orientation_from_degrees(rotation_degrees));
+}
+
+// q turned by a small angle (radians): q += angle * perp(q), renormalized
+inline glm::vec2 integrate_rotation(const glm::vec2 q, float radians) {
+    glm::vec2 r(q.x - radians * q.y, q.y + radians * q.x);
+    float length = std::sqrt(r.x * r.x + r.y * r.y);
+    return (length > 0.0f) ? r / length : glm::vec2(1.0f, 0.0f);
+}
+
+// Angle (radians) from qa to qb, in (-PI, PI]
+inline float relative_angle(const glm::vec2 qa, const glm::vec2 qb) {
+    return std::atan2(qa.x * qb.y - qa.y * qb.x, qa.x * qb.x + qa.y * qb.y);
+}
+
+// Wraps an angle (radians) into (-PI, PI]
+inline float wrap_angle(float radians) {
+    radians = std::fmod(radians + PI, 2.0f * PI);
+    if (radians <= 0.0f) radians += 2.0f * PI;
+    return radians - PI;
 }
 
 inline glm::vec2 perp(const glm::vec2 v) {
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+// 4-wide float lanes used by the batch (SoA) code paths.
+// Falls back to plain scalar arrays when SSE2 isn't available.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define FZX_SIMD_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace SIMD
+{
+    constexpr int Width = 4;
+
+#ifdef FZX_SIMD_SSE
+    struct float4 { __m128 v; };
+
+    inline float4 Load(const float* p)              { return {_mm_loadu_ps(p)}; }
+    inline void   Store(float* p, float4 a)         { _mm_storeu_ps(p, a.v); }
+    inline float4 Set(float s)                      { return {_mm_set1_ps(s)}; }
+    inline float4 Set(float a, float b, float c, float d) { return {_mm_setr_ps(a, b, c, d)}; }
+    inline float4 Zero()                            { return {_mm_setzero_ps()}; }
+    // (a, b, c, d) -> (b, a, d, c): swaps x / y of two interleaved points
+    inline float4 SwapPairs(float4 a)               { return {_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(2, 3, 0, 1))}; }
+
+    inline float4 operator+(float4 a, float4 b)     { return {_mm_add_ps(a.v, b.v)}; }
+    inline float4 operator-(float4 a, float4 b)     { return {_mm_sub_ps(a.v, b.v)}; }
+    inline float4 operator*(float4 a, float4 b)     { return {_mm_mul_ps(a.v, b.v)}; }
+    inline float4 operator/(float4 a, float4 b)     { return {_mm_div_ps(a.v, b.v)}; }
+
+    inline float4 Min(float4 a, float4 b)           { return {_mm_min_ps(a.v, b.v)}; }
+    inline float4 Max(float4 a, float4 b)           { return {_mm_max_ps(a.v, b.v)}; }
+    inline float4 Sqrt(float4 a)                    { return {_mm_sqrt_ps(a.v)}; }
+    inline float4 Truncate(float4 a)                { return {_mm_cvtepi32_ps(_mm_cvttps_epi32(a.v))}; }
+
+    // Masks: all bits set in a lane where the comparison holds
+    inline float4 Less(float4 a, float4 b)          { return {_mm_cmplt_ps(a.v, b.v)}; }
+    inline float4 LessEqual(float4 a, float4 b)     { return {_mm_cmple_ps(a.v, b.v)}; }
+    inline float4 And(float4 a, float4 b)           { return {_mm_and_ps(a.v, b.v)}; }
+    inline float4 Or(float4 a, float4 b)            { return {_mm_or_ps(a.v, b.v)}; }
+    inline float4 Select(float4 mask, float4 a, float4 b) {
+        return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+    }
+    inline int    MoveMask(float4 mask)             { return _mm_movemask_ps(mask.v); }
+#else
+    struct float4 { float v[4]; };
+
+    #define FZX_SIMD_LANES(expr) float4 r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r
+
+    inline float4 Load(const float* p)              { FZX_SIMD_LANES(p[i]); }
+    inline void   Store(float* p, float4 a)         { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+    inline float4 Set(float s)                      { FZX_SIMD_LANES(s); }
+    inline float4 Set(float a, float b, float c, float d) { return {{a, b, c, d}}; }
+    inline float4 Zero()                            { FZX_SIMD_LANES(0.0f); }
+    inline float4 SwapPairs(float4 a)               { FZX_SIMD_LANES(a.v[i ^ 1]); }
+
+    inline float4 operator+(float4 a, float4 b)     { FZX_SIMD_LANES(a.v[i] + b.v[i]); }
+    inline float4 operator-(float4 a, float4 b)     { FZX_SIMD_LANES(a.v[i] - b.v[i]); }
+    inline float4 operator*(float4 a, float4 b)     { FZX_SIMD_LANES(a.v[i] * b.v[i]); }
+    inline float4 operator/(float4 a, float4 b)     { FZX_SIMD_LANES(a.v[i] / b.v[i]); }
+
+    inline float4 Min(float4 a, float4 b)           { FZX_SIMD_LANES(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+    inline float4 Max(float4 a, float4 b)           { FZX_SIMD_LANES(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+    inline float4 Sqrt(float4 a)                    { FZX_SIMD_LANES(std::sqrt(a.v[i])); }
+    inline float4 Truncate(float4 a)                { FZX_SIMD_LANES(std::trunc(a.v[i])); }
+
+    // Masks are stored as 1.0f / 0.0f lanes in the scalar fallback
+    inline float4 Less(float4 a, float4 b)          { FZX_SIMD_LANES(a.v[i] < b.v[i] ? 1.0f : 0.0f); }
+    inline float4 LessEqual(float4 a, float4 b)     { FZX_SIMD_LANES(a.v[i] <= b.v[i] ? 1.0f : 0.0f); }
+    inline float4 And(float4 a, float4 b)           { FZX_SIMD_LANES((a.v[i] != 0.0f && b.v[i] != 0.0f) ? 1.0f : 0.0f); }
+    inline float4 Or(float4 a, float4 b)            { FZX_SIMD_LANES((a.v[i] != 0.0f || b.v[i] != 0.0f) ? 1.0f : 0.0f); }
+    inline float4 Select(float4 mask, float4 a, float4 b) { FZX_SIMD_LANES(mask.v[i] != 0.0f ? a.v[i] : b.v[i]); }
+    inline int    MoveMask(float4 mask) {
+        int bits = 0;
+        for (int i = 0; i < 4; i++) if (mask.v[i] != 0.0f) bits |= 1 << i;
+        return bits;
+    }
+
+    #undef FZX_SIMD_LANES
+#endif
+}
@@ -3,6 +3,7 @@
 
 #include "Engine/Object/Object.h"
 #include "Engine/Servers/PhysicsServer/PhysicsServer.hpp"
+#include "Engine/Servers/SystemServer/SystemServer.hpp"
 
 
 std::random_device rd;
@@ -11,8 +12,8 @@ std::uniform_real_distribution<float> distX(10.0f, 1270.0f);
 std::uniform_real_distribution<float> distY(10.0f, 710.0f);
 std::uniform_real_distribution<float> randi(-1, 1);
 
-std::vector<RigidBody2D*> rigs;
-std::unordered_set<RigidBody2D*> inBoard;
+std::vector<Handle<RigidBody2D>> rigs;   // generational, a removed body resolves to null
+size_t inBoard = 0;
 
 // ---------------- Global Variables ----------------
 
@@ -28,8 +29,8 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
 void processInput(GLFWwindow* window) {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
         glfwSetWindowShouldClose(window, true);
-    if (glfwGetKey(window, GLFW_KEY_KP_ADD) == GLFW_PRESS) {
-        RigidBody2D* rig = rigs.back();
+    if (glfwGetKey(window, GLFW_KEY_KP_ADD) == GLFW_PRESS && !rigs.empty()) {
+        RigidBody2D* rig = RigidBody2D::Resolve(rigs.back());
         rigs.pop_back();
         delete rig;
     }
@@ -79,16 +80,16 @@ int main() {
 
     // ---------------- Init Scene ----------------
     AABB board = {{screenWidth / 2, screenHeight / 2}, {screenWidth / 2, screenHeight / 2}};
-    PhysicsServer::CollisionSystem::SpatialGrid = new CollisionSpatialGrid(board);
+    PhysicsServer::World().Collisions.SpatialGrid.Board = board;
     Renderer2D::Init(screenWidth, screenHeight);
 
     for (int i = 0; i < 50; i++) {
         i++;
         glm::vec2 randomPos(distX(gen), distY(gen));
 
-        rigs.push_back(new RigidBody2D(
+        RigidBody2D* newRig = new RigidBody2D(
             new Collision2D(
-                new Circle2D(25.0f, 16), 
+                ShapeLibrary::Circle(25.0f, 16), 
                 {0, 0, 0, 0}, 
                 {0, 1, 0, 1}, 
                 {0, 0, 0, 0}
@@ -99,9 +100,9 @@ int main() {
             1.0f,  // GravityScale
             0.01f,  // L.Damping
             0.01f   // A.Damping
-        ));
+        );
+        rigs.push_back(newRig->GetHandle());
 
-        RigidBody2D* newRig = rigs.back();
         newRig->transform->position = randomPos;
         newRig->ApplyForce({640 * randi(gen) * 30, 360 * randi(gen) * 30});
     }
@@ -116,7 +117,7 @@ int main() {
 
     col->transform->position = {100, 100};
     col->transform->scale = {5, 5};
-    col->transform->rotation = 45.0f;
+    col->transform->setRotation(45.0f);
 
     StaticBody2D* sb = new StaticBody2D(new Collision2D(new Box2D(1280, 50), {1, 1, 1, 1}, glm::vec4(0.0f)));
     sb->transform->position = {640, 745};
@@ -130,6 +131,31 @@ int main() {
     StaticBody2D* sb4 = new StaticBody2D(new Collision2D(new Box2D(1280, 50), {1, 1, 1, 1}, glm::vec4(0.0f)));
     sb4->transform->position = {640, -25};
 
+    // ---------------- Systems ----------------
+    SystemServer::Add(FrameStage::Input, "input", [&](float) {
+        processInput(window);
+    });
+    SystemServer::Add(FrameStage::Physics, "physics", [](float delta) {
+        PhysicsServer::Update(delta);
+    });
+    SystemServer::Add(FrameStage::LateUpdate, "board count", [&](float) {
+        // One pass over the body store instead of a set lookup per body
+        const RigidBodyStore& store = PhysicsServer::World().RigidBodies.Store;
+        inBoard = 0;
+        for (size_t i = 0; i < store.Size(); i++) {
+            if (board.contains(store.owners[i]->transform->position)) inBoard++;
+        }
+    });
+    SystemServer::Add(FrameStage::Draw, "bodies", [](float) {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        const RigidBodyStore& store = PhysicsServer::World().RigidBodies.Store;
+        for (size_t i = 0; i < store.Size(); i++) {
+            if (Collision2D* col = store.owners[i]->collision) col->Draw();
+        }
+        Renderer2D::Render();
+    });
+
     // ---------------- Main Loop ----------------
     while (!glfwWindowShouldClose(window)) {
         auto currentTime = std::chrono::high_resolution_clock::now();
@@ -141,31 +167,11 @@ int main() {
         while (deltaTime >= FrameTime) {
             
             
-            processInput(window);
-
-            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-            PhysicsServer::Update();
-
-            for (RigidBody2D* rig : rigs) {
-                if (rig)
-                    rig->OnUpdate(deltaTime);
-                    rig->OnDraw();
-                    bool inside = board.contains(rig->transform->position);
-
-                    if (inside && inBoard.find(rig) == inBoard.end()) {
-                        inBoard.insert(rig);
-                    } 
-                    else if (!inside && inBoard.find(rig) != inBoard.end()) {
-                        inBoard.erase(rig);
-                    }
-            }
-
-            Renderer2D::Render();
-            
+            SystemServer::Update(deltaTime);
+
             std::cout << int(1.0f/deltaTime)  << "FPS" << std::endl;
             std::cout << "rigs : " << rigs.size() << std::endl;
-            std::cout << "in board :" << inBoard.size() << std::endl;
+            std::cout << "in board :" << inBoard << std::endl;
 
             glfwSwapBuffers(window);
             glfwPollEvents();
@@ -174,8 +180,8 @@ int main() {
         }
     }
 
-    for(RigidBody2D* rig : rigs) {
-        delete rig;
+    for (Handle<RigidBody2D> handle : rigs) {
+        delete RigidBody2D::Resolve(handle);
     }
     glfwDestroyWindow(window);
     glfwTerminate();
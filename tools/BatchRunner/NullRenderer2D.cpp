@@ -0,0 +1,14 @@
+#include <Engine/Renderer/2D/Renderer2D.hpp>
+
+// Headless Renderer2D for FZXBatch: the engine's draw paths link, nothing reaches OpenGL.
+// The header only needs the glad declarations (vendor/glad), not the loader.
+
+bool Renderer2D::isInit() { return false; }
+void Renderer2D::Init(int, int) {}
+void Renderer2D::Delete() {}
+
+void Renderer2D::DrawPolygon(std::span<const glm::vec2>, const glm::vec4&) {}
+void Renderer2D::DrawLines(std::span<const glm::vec2>, const glm::vec4&, float) {}
+void Renderer2D::DrawPoints(std::span<const glm::vec2>, const glm::vec4&, float) {}
+
+void Renderer2D::Render() {}
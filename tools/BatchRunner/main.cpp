@@ -0,0 +1,107 @@
+#include <random>
+#include <iostream>
+#include <cstdlib>
+#include <string>
+
+#include "Engine/Object/Object.h"
+#include "Engine/Servers/PhysicsServer/PhysicsWorld.hpp"
+#include "Engine/Servers/PhysicsServer/Batch/BatchRunner.hpp"
+#include "Engine/Servers/PhysicsServer/Replication/ReplicationCodec.hpp"
+#include "Engine/Servers/JobServer/JobServer.hpp"
+
+// Headless sweep: FZXBatch [worlds] [steps] [threads]
+// Every world is a walled ball pit with its own seed, restitution and solver mode.
+// FZXBatch --replication [ticks] [ackDelay] [bodies]: snapshot replication bandwidth on one ball pit,
+// or with a body count on a falling grid of that many small circles (10000 for the bandwidth target).
+
+// ---------------- Scene ----------------
+static void BallPit(PhysicsWorld& world, const Batch::WorldConfig& config)
+{
+    std::mt19937 gen(uint32_t(config.seed));
+    std::uniform_real_distribution<float> distX(60.0f, 1220.0f);
+    std::uniform_real_distribution<float> distY(60.0f, 500.0f);
+    std::uniform_real_distribution<float> restitution(0.0f, 0.8f);
+
+    world.Mode = (config.seed % 2) ? SolverMode::XPBD : SolverMode::SequentialImpulse;
+    world.Determinism.Enabled = true;
+
+    const float e = restitution(gen);
+    for (int i = 0; i < 100; i++) {
+        RigidBody2D* body = new RigidBody2D(world.CreateCollision(ShapeLibrary::Circle(10.0f, 16)), 1.0f, e, 0.5f);
+        body->transform->position = {distX(gen), distY(gen)};
+    }
+
+    const glm::vec2 walls[4][2] = {
+        {{640, 745}, {1280, 50}}, {{640, -25}, {1280, 50}},
+        {{-25, 360}, {50, 720}},  {{1305, 360}, {50, 720}}
+    };
+    for (const auto& wall : walls) {
+        StaticBody2D* sb = new StaticBody2D(world.CreateCollision(ShapeLibrary::Box(wall[1].x, wall[1].y)));
+        sb->transform->position = wall[0];
+    }
+}
+
+// Rows of 200 sleep-enabled circles, 6 px apart, falling with nothing below them
+static void FallingGrid(PhysicsWorld& world, int count)
+{
+    for (int i = 0; i < count; i++) {
+        RigidBody2D* body = new RigidBody2D(world.CreateCollision(ShapeLibrary::Circle(3.0f, 6)), 1.0f, 0.5f, 0.5f, 1.0f, 0.01f, 0.01f, true);
+        body->transform->position = {20.0f + float(i % 200) * 6.0f, 20.0f + float(i / 200) * 6.0f};
+    }
+}
+
+// ------------- Replication -------------
+static int MeasureReplication(int argc, char** argv)
+{
+    const int ticks = argc > 2 ? std::atoi(argv[2]) : 600;
+    const int ackDelay = argc > 3 ? std::atoi(argv[3]) : 2;
+    const int bodies = argc > 4 ? std::atoi(argv[4]) : 0;
+
+    Batch::WorldConfig config;
+    PhysicsWorld world(config.bounds);
+    if (bodies > 0) FallingGrid(world, bodies);
+    else BallPit(world, config);
+    const Replication::LoopbackStats stats = Replication::MeasureLoopback(world, ticks, config.delta, ackDelay);
+
+    std::cout << world.RigidBodies.Store.Size() << " bodies, " << ticks << " ticks, ack delay " << ackDelay << "\n"
+              << stats.bytesPerTick << " bytes/tick (raw floats " << stats.rawBytesPerTick << ")\n"
+              << "mismatches " << stats.mismatches << "\n";
+    return stats.mismatches == 0 ? 0 : 1;
+}
+
+// ---------------- Main ----------------
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--replication") return MeasureReplication(argc, argv);
+
+    const size_t worldCount = argc > 1 ? size_t(std::atoll(argv[1])) : 256;
+    const int steps = argc > 2 ? std::atoi(argv[2]) : 300;
+    if (argc > 3) JobServer::WorkerCount = unsigned(std::max(std::atoi(argv[3]) - 1, 0));
+
+    std::vector<Batch::WorldConfig> configs(worldCount);
+    for (size_t i = 0; i < worldCount; i++) {
+        configs[i].steps = steps;
+        configs[i].seed = i;
+        configs[i].setup = BallPit;
+    }
+
+    Batch::Options options;
+    options.captureBodies = false;
+
+    std::vector<Batch::WorldResult> results;
+    const Batch::RunStats stats = Batch::Run(configs, results, options);
+
+    float worstPenetration = 0.0f;
+    size_t sleeping = 0;
+    for (const Batch::WorldResult& result : results) {
+        worstPenetration = std::max(worstPenetration, result.maxPenetration);
+        sleeping += result.sleeping;
+    }
+
+    std::cout << stats.worlds << " worlds, " << stats.worldSteps << " world-steps in " << stats.seconds << " s ("
+              << stats.stepSeconds << " s stepping)\n"
+              << stats.worldStepsPerSecond << " world-steps/s\n"
+              << "worst penetration " << worstPenetration << " px, sleeping bodies " << sleeping << "\n";
+    if (!results.empty()) std::cout << "world 0 hash " << std::hex << results[0].hash << std::dec << "\n";
+    return 0;
+}